@@ -0,0 +1,76 @@
+/***
+ ADC 블록 수집 (핑퐁 버퍼: 생산자 = ADC 인터럽트 또는 전송(DTC) 완료 인터럽트, 소비자 = main loop)
+ - 생산자가 한 블록을 채우는 동안 소비자는 다른(완성된) 블록을 처리
+ - 소비자가 블록 하나 이상 밀리면, 처리 안 된 블록은 보존하고 새로 채운 블록을 버림 (overrun)
+   > 소비자가 읽는 블록에는 절대 쓰지 않음 (처리 중 데이터가 바뀌지 않음)
+ - 채우는 방법 두 가지 (같은 핸드오프)
+   샘플마다 : adc_block_write()  (스캔 완료 콜백에서 1샘플씩)
+   블록마다 : adc_block_fill_ptr() 를 전송 목적지로 두고, 블록 전송이 끝나면 adc_block_filled()
+              (반환값이 다음 전송 목적지, 전송 드라이버가 있는 경우 샘플마다 CPU 가 하는 일 없음)
+ - fill, index 는 생산자만, next 는 소비자만 변경 > ready[] 로만 주고받음 (인터럽트를 막지 않아도 됨)
+ ***/
+#ifndef ADC_BLOCK_H
+#define ADC_BLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define ADC_BLOCK_SIZE 64
+
+typedef struct {
+    uint16_t block[2][ADC_BLOCK_SIZE];
+    uint8_t fill;               // 생산자가 채우는 블록 번호 (생산자 전용)
+    uint16_t index;             // 채우는 블록 안의 위치 (adc_block_write 전용)
+    volatile _Bool ready[2];    // 완성된 블록 (생산자: true, 소비자: 처리 후 false)
+    uint8_t next;               // 다음에 처리할 블록 번호 (소비자 전용)
+    volatile uint32_t overrun;  // 처리가 늦어서 버린 블록 수 (누적)
+} adc_block_buf_t;
+
+// ■ 초기화 (생산자가 멈춘 상태에서)
+static inline void adc_block_reset(adc_block_buf_t *bb) {
+    memset(bb, 0, sizeof(*bb));
+}
+
+// ■ 생산자가 지금 채워야 하는 블록 (전송 목적지)
+static inline uint16_t *adc_block_fill_ptr(adc_block_buf_t *bb) {
+    return bb->block[bb->fill];
+}
+
+// ■ 블록이 다 참 (생산자): 소비자에게 넘기고 다음 채울 블록 반환, 넘겼으면 *handed = true
+static inline uint16_t *adc_block_filled(adc_block_buf_t *bb, _Bool *handed) {
+    uint8_t other = (uint8_t)(bb->fill ^ 1U);
+    if (bb->ready[other]) {
+        bb->overrun++;  // 다른 블록이 아직 처리 중 > 같은 블록을 다시 채움
+        *handed = false;
+    }
+    else {
+        bb->ready[bb->fill] = true;
+        bb->fill = other;
+        *handed = true;
+    }
+    return bb->block[bb->fill];
+}
+
+// ■ 1샘플 추가 (생산자), 블록을 소비자에게 넘겼으면 true
+static inline _Bool adc_block_write(adc_block_buf_t *bb, uint16_t data) {
+    bb->block[bb->fill][bb->index] = data;
+    if (++bb->index < ADC_BLOCK_SIZE) return false;
+    bb->index = 0;
+    _Bool handed;
+    (void)adc_block_filled(bb, &handed);
+    return handed;
+}
+
+// ■ 처리할 블록 (소비자), 없으면 NULL
+static inline const uint16_t *adc_block_peek(const adc_block_buf_t *bb) {
+    return bb->ready[bb->next] ? bb->block[bb->next] : (const uint16_t *)0;
+}
+
+// ■ adc_block_peek 블록 처리 끝 (소비자): 생산자에게 돌려줌
+static inline void adc_block_release(adc_block_buf_t *bb) {
+    bb->ready[bb->next] = false;
+    bb->next ^= 1U;
+}
+
+#endif /* ADC_BLOCK_H */
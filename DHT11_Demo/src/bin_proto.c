@@ -0,0 +1,115 @@
+#include "bin_proto.h"
+#include <string.h>
+
+// ■ CRC-16/CCITT-FALSE 1바이트 갱신
+uint16_t crc16_update(uint16_t crc, uint8_t data) {
+    crc ^= (uint16_t)(data << 8);
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+    }
+    return crc;
+}
+
+// ■ 수신 초기화 (누적 횟수 포함)
+void bin_rx_reset(bin_rx_t *rx) {
+    memset(rx, 0, sizeof(*rx));
+}
+
+// ■ 프레임 완성: 응답 대기로 (수신 상태는 다음 0xA5 기다림)
+static void bin_rx_complete(bin_rx_t *rx, bin_status_t status) {
+    rx->status = status;
+    rx->pending = true;
+    rx->state = BIN_STATE_IDLE;
+}
+
+// ■ 바이너리 프레임 수신 (1바이트씩, pending 이면 넣지 않아야 함)
+void bin_rx_feed(bin_rx_t *rx, uint8_t c) {
+    switch (rx->state) {
+        case BIN_STATE_IDLE:
+            if (c == BIN_SYNC) {
+                rx->active = true;
+                rx->state = BIN_STATE_LEN;
+            }
+            else rx->skipped++; // 프레임 사이의 깨진 바이트
+            break;
+        case BIN_STATE_LEN:
+            rx->len = c;
+            rx->index = 0;
+            rx->state = BIN_STATE_SEQ;
+            break;
+        case BIN_STATE_SEQ:
+            rx->seq = c;
+            // 길이가 틀렸으면 명령어를 기다리지 않고 바로 응답 > 이어지는 바이트는 다음 0xA5 까지 건너뜀
+            if (rx->len > BIN_PAYLOAD_MAX) {
+                rx->len_errors++;
+                bin_rx_complete(rx, BIN_STATUS_LEN);
+            }
+            else rx->state = (rx->len > 0) ? BIN_STATE_PAYLOAD : BIN_STATE_CRC_LO;
+            break;
+        case BIN_STATE_PAYLOAD:
+            rx->payload[rx->index] = c;
+            if (++rx->index >= rx->len) rx->state = BIN_STATE_CRC_LO;
+            break;
+        case BIN_STATE_CRC_LO:
+            rx->crc = c;
+            rx->state = BIN_STATE_CRC_HI;
+            break;
+        case BIN_STATE_CRC_HI: {
+            rx->crc |= (uint16_t)(c << 8);
+
+            uint16_t crc = crc16_update(0xFFFF, rx->len);
+            crc = crc16_update(crc, rx->seq);
+            for (uint8_t i = 0; i < rx->len; i++) crc = crc16_update(crc, rx->payload[i]);
+
+            if (crc != rx->crc) {
+                rx->crc_errors++;
+                bin_rx_complete(rx, BIN_STATUS_CRC);
+            }
+            else bin_rx_complete(rx, BIN_STATUS_OK);
+            break;
+        }
+    }
+}
+
+// ■ 완성된 프레임 처리: 실행하고 응답 (송신 링버퍼에 응답 자리가 없으면 실행하지 않고 false)
+_Bool bin_rx_finish(bin_rx_t *rx, uart_tx_ring_t *tx, bin_execute_t execute) {
+    if (!rx->pending) return true;
+    if ((uint16_t)(UART_TX_RING_SIZE - (uint16_t)(tx->head - tx->tail)) < BIN_REPLY_SIZE) {
+        rx->reply_waits++;
+        return false; // 송신 완료 후 다시
+    }
+    bin_status_t status = rx->status;
+    if (status == BIN_STATUS_OK) {
+        status = execute(rx->payload, rx->len);
+        rx->frames++;
+    }
+    rx->pending = false;
+    bin_send_reply(tx, rx->seq, status); // 자리를 확인했으므로 실패하지 않음
+    return true;
+}
+
+// ■ 바이트 간 시간 초과 (수신이 멈춤): 중간까지 받은 프레임은 응답 없이 버리고 세션 끝
+void bin_rx_timeout(bin_rx_t *rx) {
+    if (rx->state != BIN_STATE_IDLE) {
+        rx->timeouts++;
+        rx->state = BIN_STATE_IDLE;
+    }
+    rx->active = false;
+}
+
+// ■ 바이너리 응답 송신 (송신 링버퍼에 자리가 없으면 보내지 않고 false, 일부만 보내는 일 없음)
+_Bool bin_send_reply(uart_tx_ring_t *tx, uint8_t seq, bin_status_t status) {
+    uint8_t frame[3] = { 1, seq, (uint8_t)status }; // 길이, seq, 상태
+    uint16_t crc = 0xFFFF;
+    uart_tx_msg_t msg;
+    tx_msg_begin(tx, &msg);
+    if (msg.space < BIN_REPLY_SIZE) return false; // 드롭 횟수에 넣지 않음 (로그가 아님)
+    tx_msg_byte(&msg, BIN_SYNC);
+    for (uint8_t i = 0; i < sizeof(frame); i++) {
+        tx_msg_byte(&msg, frame[i]);
+        crc = crc16_update(crc, frame[i]);
+    }
+    tx_msg_byte(&msg, (uint8_t)crc);
+    tx_msg_byte(&msg, (uint8_t)(crc >> 8));
+    return tx_msg_end(&msg);
+}
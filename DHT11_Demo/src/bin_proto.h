@@ -0,0 +1,80 @@
+/***
+ 바이너리 프로토콜 (PC 자동화 프로그램용, ASCII HDR...TAIL 과 같이 사용 가능)
+ 요청: [0xA5][길이 N][seq][명령어 N바이트][CRC16 하위][CRC16 상위]
+       명령어 = HDR 과 TAIL 사이의 내용과 같음 (예: "R50;G10;B40")
+ 응답: [0xA5][1][seq][상태][CRC16 하위][CRC16 상위]
+ CRC16: CRC-16/CCITT-FALSE (다항식 0x1021, 초기값 0xFFFF), 길이 ~ 명령어 까지 계산
+ 응답을 기다리지 않고 여러 요청을 연속으로 보내도 됨 (seq 로 응답 구분, 받은 순서대로 처리)
+ 0xA5 는 ASCII 가 아니라서, ASCII 명령어 시작 위치에서 0xA5 가 오면 바이너리 프레임으로 판단
+ PC 쪽 예제: tools/uart_bin_client.py
+
+ - 바이너리 세션: 첫 0xA5 부터 수신이 BIN_RX_TIMEOUT_MS 동안 멈출 때까지, 모든 바이트를 바이너리로 처리
+   (프레임 사이의 깨진 바이트는 0xA5 가 나올 때까지 건너뜀 > ASCII 파서로 가지 않음)
+ - 길이가 BIN_PAYLOAD_MAX 보다 크면 seq 를 받은 직후 LEN 응답 후 다음 0xA5 를 찾음 (명령어를 기다리지 않음)
+ - 프레임 중간에 BIN_RX_TIMEOUT_MS 동안 바이트가 오지 않으면 (바이트 손실) 응답 없이 버리고 세션 끝
+   시간 측정은 사용하는 쪽의 타이머 (바이트마다 다시 시작, 만료되면 bin_rx_timeout())
+ - 응답은 송신 링버퍼에 자리가 있을 때만 보냄: 자리가 없으면 프레임을 pending 으로 두고
+   bin_rx_finish() 가 성공할 때까지 다음 바이트를 넣지 않음 (응답을 버리지 않음, 수신 링버퍼가 대신 기다림)
+ ***/
+#ifndef BIN_PROTO_H
+#define BIN_PROTO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_tx.h"
+
+#define BIN_SYNC 0xA5
+#define BIN_PAYLOAD_MAX 48
+#define BIN_REPLY_SIZE 6        // 응답 프레임 크기
+#define BIN_RX_TIMEOUT_MS 50    // 프레임 안의 바이트 간 최대 간격 / 세션 종료 간격
+
+typedef enum {
+    BIN_STATE_IDLE,     // 0xA5 기다림
+    BIN_STATE_LEN,
+    BIN_STATE_SEQ,
+    BIN_STATE_PAYLOAD,
+    BIN_STATE_CRC_LO,
+    BIN_STATE_CRC_HI
+} bin_state_t;
+
+typedef enum {
+    BIN_STATUS_OK = 0,      // 실행 완료
+    BIN_STATUS_CRC = 1,     // CRC 오류 (실행 안 함)
+    BIN_STATUS_CMD = 2,     // 명령어 형식 오류 (실행 안 함)
+    BIN_STATUS_LEN = 3      // 길이 오류 (실행 안 함)
+} bin_status_t;
+
+typedef struct {
+    bin_state_t state;
+    _Bool active;                       // 바이너리 세션 중 (시간 초과 전까지 모든 바이트를 받음)
+    _Bool pending;                      // 응답을 보내지 못한 프레임 있음 (bin_rx_finish 로 처리)
+    bin_status_t status;                // pending 프레임: OK 면 실행 후 응답, 아니면 이 상태로 응답
+    uint8_t len;                        // 명령어 길이
+    uint8_t seq;                        // 요청 번호 (응답에 그대로 돌려줌)
+    uint8_t index;                      // 받은 명령어 바이트 수
+    uint8_t payload[BIN_PAYLOAD_MAX];
+    uint16_t crc;                       // 받은 CRC
+    uint32_t frames;                    // 실행한 프레임 수 (누적)
+    uint32_t crc_errors;                // CRC 오류 횟수 (누적)
+    uint32_t len_errors;                // 길이 오류 횟수 (누적)
+    uint32_t timeouts;                  // 프레임 중간 시간 초과 횟수 (누적)
+    uint32_t skipped;                   // 세션 중 프레임 밖에서 건너뛴 바이트 수 (누적)
+    uint32_t reply_waits;               // 송신 링버퍼에 자리가 없어 응답을 미룬 횟수 (누적)
+} bin_rx_t;
+
+// 요청 실행 (명령어, 길이) > 응답 상태
+typedef bin_status_t (*bin_execute_t)(const uint8_t *payload, uint8_t len);
+
+uint16_t crc16_update(uint16_t crc, uint8_t data);
+void bin_rx_reset(bin_rx_t *rx);
+void bin_rx_feed(bin_rx_t *rx, uint8_t c);
+_Bool bin_rx_finish(bin_rx_t *rx, uart_tx_ring_t *tx, bin_execute_t execute);
+void bin_rx_timeout(bin_rx_t *rx);
+_Bool bin_send_reply(uart_tx_ring_t *tx, uint8_t seq, bin_status_t status);
+
+// ■ 이 바이트를 바이너리 수신에 넣어야 하는지 (ascii_idle: ASCII 파서가 명령어 시작 위치)
+static inline _Bool bin_rx_owns(const bin_rx_t *rx, uint8_t c, _Bool ascii_idle) {
+    return rx->active || (c == BIN_SYNC && ascii_idle);
+}
+
+#endif /* BIN_PROTO_H */
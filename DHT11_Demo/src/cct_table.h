@@ -0,0 +1,105 @@
+/* tools/cct_table.py 로 생성 (직접 수정하지 말 것) */
+#ifndef CCT_TABLE_H
+#define CCT_TABLE_H
+
+#define CCT_TABLE_MIN_K 1000
+#define CCT_TABLE_MAX_K 10000
+#define CCT_TABLE_STEP_K 100
+#define CCT_TABLE_COUNT 91
+#define CCT_TABLE_ONE 4096
+
+// {R, G, B} (Q12), 1000K ~ 10000K, 100K 간격
+#define CCT_TABLE_VALUES \
+    { 4096, 1091,    0 }, /*  1000K */ \
+    { 4096, 1243,    0 }, /*  1100K */ \
+    { 4096, 1382,    0 }, /*  1200K */ \
+    { 4096, 1510,    0 }, /*  1300K */ \
+    { 4096, 1629,    0 }, /*  1400K */ \
+    { 4096, 1739,    0 }, /*  1500K */ \
+    { 4096, 1842,    0 }, /*  1600K */ \
+    { 4096, 1939,    0 }, /*  1700K */ \
+    { 4096, 2030,    0 }, /*  1800K */ \
+    { 4096, 2117,    0 }, /*  1900K */ \
+    { 4096, 2198,  223 }, /*  2000K */ \
+    { 4096, 2276,  435 }, /*  2100K */ \
+    { 4096, 2351,  629 }, /*  2200K */ \
+    { 4096, 2422,  807 }, /*  2300K */ \
+    { 4096, 2490,  972 }, /*  2400K */ \
+    { 4096, 2555, 1125 }, /*  2500K */ \
+    { 4096, 2618, 1269 }, /*  2600K */ \
+    { 4096, 2678, 1404 }, /*  2700K */ \
+    { 4096, 2736, 1531 }, /*  2800K */ \
+    { 4096, 2792, 1651 }, /*  2900K */ \
+    { 4096, 2846, 1766 }, /*  3000K */ \
+    { 4096, 2899, 1874 }, /*  3100K */ \
+    { 4096, 2949, 1978 }, /*  3200K */ \
+    { 4096, 2999, 2077 }, /*  3300K */ \
+    { 4096, 3046, 2171 }, /*  3400K */ \
+    { 4096, 3093, 2262 }, /*  3500K */ \
+    { 4096, 3138, 2349 }, /*  3600K */ \
+    { 4096, 3181, 2433 }, /*  3700K */ \
+    { 4096, 3224, 2514 }, /*  3800K */ \
+    { 4096, 3266, 2592 }, /*  3900K */ \
+    { 4096, 3306, 2668 }, /*  4000K */ \
+    { 4096, 3345, 2741 }, /*  4100K */ \
+    { 4096, 3384, 2811 }, /*  4200K */ \
+    { 4096, 3422, 2880 }, /*  4300K */ \
+    { 4096, 3458, 2946 }, /*  4400K */ \
+    { 4096, 3494, 3011 }, /*  4500K */ \
+    { 4096, 3529, 3073 }, /*  4600K */ \
+    { 4096, 3564, 3134 }, /*  4700K */ \
+    { 4096, 3597, 3194 }, /*  4800K */ \
+    { 4096, 3630, 3251 }, /*  4900K */ \
+    { 4096, 3663, 3308 }, /*  5000K */ \
+    { 4096, 3694, 3363 }, /*  5100K */ \
+    { 4096, 3725, 3416 }, /*  5200K */ \
+    { 4096, 3756, 3469 }, /*  5300K */ \
+    { 4096, 3785, 3520 }, /*  5400K */ \
+    { 4096, 3815, 3570 }, /*  5500K */ \
+    { 4096, 3844, 3619 }, /*  5600K */ \
+    { 4096, 3872, 3667 }, /*  5700K */ \
+    { 4096, 3900, 3713 }, /*  5800K */ \
+    { 4096, 3927, 3759 }, /*  5900K */ \
+    { 4096, 3954, 3804 }, /*  6000K */ \
+    { 4096, 3980, 3848 }, /*  6100K */ \
+    { 4096, 4006, 3892 }, /*  6200K */ \
+    { 4096, 4032, 3934 }, /*  6300K */ \
+    { 4096, 4057, 3976 }, /*  6400K */ \
+    { 4096, 4082, 4016 }, /*  6500K */ \
+    { 4096, 4096, 4096 }, /*  6600K */ \
+    { 4087, 3996, 4096 }, /*  6700K */ \
+    { 4015, 3955, 4096 }, /*  6800K */ \
+    { 3952, 3920, 4096 }, /*  6900K */ \
+    { 3897, 3889, 4096 }, /*  7000K */ \
+    { 3848, 3861, 4096 }, /*  7100K */ \
+    { 3804, 3836, 4096 }, /*  7200K */ \
+    { 3763, 3813, 4096 }, /*  7300K */ \
+    { 3726, 3792, 4096 }, /*  7400K */ \
+    { 3692, 3772, 4096 }, /*  7500K */ \
+    { 3661, 3754, 4096 }, /*  7600K */ \
+    { 3631, 3737, 4096 }, /*  7700K */ \
+    { 3604, 3721, 4096 }, /*  7800K */ \
+    { 3578, 3705, 4096 }, /*  7900K */ \
+    { 3553, 3691, 4096 }, /*  8000K */ \
+    { 3530, 3677, 4096 }, /*  8100K */ \
+    { 3508, 3665, 4096 }, /*  8200K */ \
+    { 3488, 3652, 4096 }, /*  8300K */ \
+    { 3468, 3641, 4096 }, /*  8400K */ \
+    { 3449, 3629, 4096 }, /*  8500K */ \
+    { 3431, 3619, 4096 }, /*  8600K */ \
+    { 3414, 3608, 4096 }, /*  8700K */ \
+    { 3398, 3598, 4096 }, /*  8800K */ \
+    { 3382, 3589, 4096 }, /*  8900K */ \
+    { 3366, 3580, 4096 }, /*  9000K */ \
+    { 3352, 3571, 4096 }, /*  9100K */ \
+    { 3338, 3562, 4096 }, /*  9200K */ \
+    { 3324, 3554, 4096 }, /*  9300K */ \
+    { 3311, 3546, 4096 }, /*  9400K */ \
+    { 3298, 3538, 4096 }, /*  9500K */ \
+    { 3286, 3531, 4096 }, /*  9600K */ \
+    { 3274, 3523, 4096 }, /*  9700K */ \
+    { 3262, 3516, 4096 }, /*  9800K */ \
+    { 3251, 3510, 4096 }, /*  9900K */ \
+    { 3240, 3503, 4096 } /* 10000K */
+
+#endif /* CCT_TABLE_H */
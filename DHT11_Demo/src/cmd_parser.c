@@ -0,0 +1,108 @@
+#include "cmd_parser.h"
+#include <string.h>
+
+// ■ 명령어 파서 초기화 (다음 명령어 기다림)
+void cmd_parser_reset(cmd_parser_t *p) {
+    p->state = CMD_STATE_HEADER;
+    p->match = 0;
+    p->tail_match = 0;
+    p->count = 0;
+    memset(p->cmds, 0, sizeof(p->cmds));
+}
+
+// ■ "TAIL" 일치 글자 수 갱신 ("TAIL" 은 앞뒤가 겹치는 부분이 없어서, 틀리면 'T' 부터 다시 시작)
+static inline uint8_t cmd_tail_step(uint8_t matched, uint8_t c) {
+    if (matched < 4 && c == (uint8_t)TAIL[matched]) return (uint8_t)(matched + 1);
+    return (c == 'T') ? 1 : 0;
+}
+
+// ■ 명령어 파서에 1바이트 입력
+// 반환값: CMD_RESULT_READY(p->cmds[0 ~ count-1] 사용 가능) | CMD_RESULT_ERROR(형식 오류) | CMD_RESULT_NONE(계속 입력)
+cmd_result_t cmd_parser_feed(cmd_parser_t *p, uint8_t c) {
+    command_t *cmd = &p->cmds[p->count < CMD_BATCH_MAX ? p->count : CMD_BATCH_MAX - 1]; // 작성 중인 명령어
+
+    // 종료 문자: 지금까지 받은 내용으로 판정
+    if (c == END_CHARACTER) {
+        cmd_result_t result = CMD_RESULT_ERROR;
+        // TAIL 로 끝났고, TAIL 이 명령 문자를 잡아먹지 않았으면 (예: "HDRTAIL" 은 빈 명령어)
+        if ((p->state == CMD_STATE_NUMBER || p->state == CMD_STATE_WORD)
+            && p->tail_match == 4 && cmd->word_len >= 4) {
+            cmd->word_len = (uint8_t)(cmd->word_len - 4);
+            cmd->word[cmd->word_len] = '\0';
+            p->count++;
+            result = CMD_RESULT_READY;
+        }
+        // 다음 프레임 기다림 (cmds 는 다음 프레임 첫 바이트에서 지움 > 실행할 때까지 유지)
+        p->state = CMD_STATE_HEADER;
+        p->match = 0;
+        p->tail_match = 0;
+        return result;
+    }
+
+    if (c == ' ') return CMD_RESULT_NONE; // 공백 무시
+
+    switch (p->state) {
+        case CMD_STATE_HEADER:
+            if (p->match == 0) {
+                if (c == '\n') break; // CR+LF 로 보내는 터미널: LF 무시
+                p->count = 0;
+                memset(&p->cmds[0], 0, sizeof(p->cmds[0])); // 첫 명령어만 (나머지는 ';' 에서 하나씩)
+            }
+            if (c == (uint8_t)HEADER[p->match]) {
+                if (++p->match == 3) p->state = CMD_STATE_OPCODE;
+            }
+            else p->state = CMD_STATE_ERROR;
+            break;
+
+        case CMD_STATE_OPCODE:
+            cmd->opcode = c;
+            p->tail_match = cmd_tail_step(0, c);
+            p->state = CMD_STATE_NUMBER;
+            break;
+
+        case CMD_STATE_NUMBER:
+            if (c >= '0' && c <= '9') {
+                uint32_t *p_number = cmd->has_fade ? &cmd->fade_ms : &cmd->value; // 'F' 뒤면 페이드 시간
+                uint32_t value = *p_number * 10U + (uint32_t)(c - '0');
+                *p_number = (value > CMD_VALUE_MAX) ? CMD_VALUE_MAX : value;
+                if (!cmd->has_fade) cmd->has_value = true;
+                else if (cmd->fade_digits < UINT8_MAX) cmd->fade_digits++;
+                p->tail_match = 0;
+                break;
+            }
+            // 숫자 인자 뒤의 'F': 이어지는 숫자는 페이드 시간 (예: R50F2000)
+            if (c == CMD_FADE_CHARACTER && cmd->has_value && !cmd->has_fade) {
+                cmd->has_fade = true;
+                p->tail_match = 0;
+                break;
+            }
+            // 'F' 뒤에 숫자 없이 다른 글자 (TAIL, ';', 문자 인자): 페이드 시간이 빠진 형식 오류 (예: R50FTAIL)
+            if (cmd->has_fade && cmd->fade_digits == 0) {
+                p->state = CMD_STATE_ERROR;
+                break;
+            }
+            p->state = CMD_STATE_WORD;
+            /* fall through */
+        case CMD_STATE_WORD:
+            // 구분 문자: 지금 명령어 완성, 다음 명령어 시작
+            if (c == CMD_SEPARATOR) {
+                if (++p->count >= CMD_BATCH_MAX) p->state = CMD_STATE_ERROR;
+                else {
+                    memset(&p->cmds[p->count], 0, sizeof(p->cmds[0]));
+                    p->state = CMD_STATE_OPCODE;
+                }
+                break;
+            }
+            if (cmd->word_len >= CMD_WORD_MAX) {
+                p->state = CMD_STATE_ERROR;
+                break;
+            }
+            cmd->word[cmd->word_len++] = (char)c;
+            p->tail_match = cmd_tail_step(p->tail_match, c);
+            break;
+
+        case CMD_STATE_ERROR:
+            break;
+    }
+    return CMD_RESULT_NONE;
+}
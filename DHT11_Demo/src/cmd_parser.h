@@ -0,0 +1,63 @@
+/***
+ 명령어 파서 (1바이트씩 받아서 해석하는 상태 머신)
+ HDR > 명령 문자(opcode) > 숫자 인자 > 문자 인자 > (';' 로 다음 명령어) > TAIL > END_CHARACTER
+ 예) HDRR50TAIL         : opcode 'R', value 50
+     HDRR50F2000TAIL    : opcode 'R', value 50, fade_ms 2000 (숫자 인자 뒤 'F' + 숫자 = 페이드 시간)
+     HDRR50FTAIL        : 오류 ('F' 뒤에 숫자가 없음)
+     HDRT10ONTAIL       : opcode 'T', value 10, word "ON"
+     HDR R50;G10;B40 TAIL: 명령어 3개를 한 프레임으로 (공백은 무시)
+ 바이트가 들어올 때마다 상태만 바꾸고, 종료 문자가 오면 해석된 command_t 가 바로 준비됨 (버퍼 재검색 없음)
+ - 문자열 검색 / 복사 / atoi 없음: 바이트마다 일정한 작업량
+ ***/
+#ifndef CMD_PARSER_H
+#define CMD_PARSER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define END_CHARACTER   '\r'        // 명령어 종료를 나타내는 문자
+#define HEADER          "HDR"       // 헤더: 패킷 시작
+#define TAIL            "TAIL"      // 테일: 패킷 끝
+
+#define CMD_WORD_MAX 8          // 문자 인자 + "TAIL" 최대 길이
+#define CMD_VALUE_MAX 65535     // 숫자 인자 최댓값 (넘으면 고정)
+#define CMD_BATCH_MAX 8         // 한 프레임에 넣을 수 있는 명령어 수
+#define CMD_SEPARATOR ';'       // 명령어 구분 문자
+#define CMD_FADE_CHARACTER 'F'  // 페이드 시간 시작 문자 (숫자 인자 바로 뒤에서만)
+typedef enum {
+    CMD_STATE_HEADER,   // "HDR" 확인 중
+    CMD_STATE_OPCODE,   // 명령 문자 기다림
+    CMD_STATE_NUMBER,   // 숫자 인자
+    CMD_STATE_WORD,     // 문자 인자 (마지막 4글자는 TAIL)
+    CMD_STATE_ERROR     // 형식 오류 > 종료 문자까지 버림
+} cmd_state_t;
+
+typedef struct {
+    uint8_t opcode;             // R | G | B | T | S | A | O | E
+    uint32_t value;             // 숫자 인자 (없으면 0)
+    _Bool has_value;            // 숫자 인자 유무
+    uint32_t fade_ms;           // 페이드 시간 (ms, 없으면 0)
+    _Bool has_fade;             // 페이드 시간 유무
+    uint8_t fade_digits;        // 'F' 뒤 숫자 개수 (0 이면 "R50F" 처럼 시간이 빠진 형식 오류)
+    char word[CMD_WORD_MAX + 1];// 문자 인자 (ON, OFF, N, FF, XIT ...), TAIL 제외
+    uint8_t word_len;
+} command_t;
+
+typedef struct {
+    cmd_state_t state;
+    uint8_t match;      // HEADER: "HDR" 일치한 글자 수
+    uint8_t tail_match; // 끝에서부터 "TAIL" 과 일치한 글자 수
+    command_t cmds[CMD_BATCH_MAX];  // 프레임 안의 명령어들
+    uint8_t count;                  // 완성된 명령어 수 (READY 이후 유효)
+} cmd_parser_t;
+
+typedef enum {
+    CMD_RESULT_NONE,    // 아직 명령어가 끝나지 않음
+    CMD_RESULT_READY,   // 명령어 해석 완료
+    CMD_RESULT_ERROR    // 형식 오류
+} cmd_result_t;
+
+void cmd_parser_reset(cmd_parser_t *p);
+cmd_result_t cmd_parser_feed(cmd_parser_t *p, uint8_t c);
+
+#endif /* CMD_PARSER_H */
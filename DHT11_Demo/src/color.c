@@ -0,0 +1,72 @@
+#include "color.h"
+#include "cct_table.h"
+
+#if CCT_TABLE_ONE != COLOR_ONE
+#error "cct_table.h 를 COLOR_ONE 에 맞게 다시 생성해야 함 (tools/cct_table.py)"
+#endif
+
+static const uint16_t g_cct_table[CCT_TABLE_COUNT][3] = { CCT_TABLE_VALUES };
+
+// ■ 0 ~ 100 (%) > 0 ~ COLOR_ONE
+static inline uint32_t color_from_percent(uint8_t percent) {
+    if (percent > COLOR_PERCENT) percent = COLOR_PERCENT;
+    return ((uint32_t)percent * COLOR_ONE + COLOR_PERCENT / 2) / COLOR_PERCENT;
+}
+
+// ■ a * b (둘 다 Q12) > Q12, 반올림
+static inline uint32_t color_mul(uint32_t a, uint32_t b) {
+    return (a * b + COLOR_ONE / 2) >> 12;
+}
+
+// ■ HSV > RGB (hue: 0 ~ 359, 넘으면 360 으로 나눈 나머지 / sat, val: 0 ~ 100)
+void color_hsv_to_rgb(uint16_t hue, uint8_t sat, uint8_t val, color_rgb_t *out) {
+    uint32_t v = color_from_percent(val);
+    uint32_t s = color_from_percent(sat);
+
+    hue = (uint16_t)(hue % COLOR_HUE_MAX);
+    uint32_t sector = hue / 60U;                                         // 0 ~ 5
+    uint32_t f = ((uint32_t)(hue % 60U) * COLOR_ONE + 30U) / 60U;        // 구간 안 위치 (Q12)
+
+    uint32_t p = color_mul(v, COLOR_ONE - s);                            // 가장 어두운 채널
+    uint32_t q = color_mul(v, COLOR_ONE - color_mul(s, f));              // 내려가는 채널
+    uint32_t t = color_mul(v, COLOR_ONE - color_mul(s, COLOR_ONE - f));  // 올라가는 채널
+
+    uint32_t r, g, b;
+    switch (sector) {
+        case 0:  r = v; g = t; b = p; break;
+        case 1:  r = q; g = v; b = p; break;
+        case 2:  r = p; g = v; b = t; break;
+        case 3:  r = p; g = q; b = v; break;
+        case 4:  r = t; g = p; b = v; break;
+        default: r = v; g = p; b = q; break;
+    }
+    out->r = (uint16_t)r;
+    out->g = (uint16_t)g;
+    out->b = (uint16_t)b;
+}
+
+// ■ 색온도 > RGB (kelvin: CCT_TABLE_MIN_K ~ CCT_TABLE_MAX_K, 범위 밖은 끝값 / val: 0 ~ 100)
+void color_cct_to_rgb(uint16_t kelvin, uint8_t val, color_rgb_t *out) {
+    if (kelvin < CCT_TABLE_MIN_K) kelvin = CCT_TABLE_MIN_K;
+    if (kelvin > CCT_TABLE_MAX_K) kelvin = CCT_TABLE_MAX_K;
+
+    uint32_t offset = (uint32_t)(kelvin - CCT_TABLE_MIN_K);
+    uint32_t index = offset / CCT_TABLE_STEP_K;
+    uint32_t frac = ((offset % CCT_TABLE_STEP_K) * COLOR_ONE) / CCT_TABLE_STEP_K; // 다음 항목까지 (Q12)
+    if (index >= CCT_TABLE_COUNT - 1U) {
+        index = CCT_TABLE_COUNT - 2U;
+        frac = COLOR_ONE;
+    }
+
+    uint32_t v = color_from_percent(val);
+    uint32_t rgb[3];
+    for (uint8_t ch = 0; ch < 3; ch++) {
+        int32_t a = g_cct_table[index][ch];
+        int32_t b = g_cct_table[index + 1U][ch];
+        uint32_t c = (uint32_t)(a + (((b - a) * (int32_t)frac) / (int32_t)COLOR_ONE));
+        rgb[ch] = color_mul(c, v);
+    }
+    out->r = (uint16_t)rgb[0];
+    out->g = (uint16_t)rgb[1];
+    out->b = (uint16_t)rgb[2];
+}
@@ -0,0 +1,24 @@
+/***
+ 색 변환 (정수 연산만 사용)
+ - HSV > RGB, 색온도(K) > RGB (tools/cct_table.py 로 만든 테이블 선형 보간)
+ - 결과는 밝기 단계 0 ~ COLOR_ONE (Q12), 감마 보정 / 화이트 밸런스 / 듀티 변환은 hal_entry.c 에서
+ - 나눗셈은 상수 나눗셈만 (컴파일러가 곱셈으로 바꿈) > 페이드 인터럽트 안에서 불러도 될 만큼 가벼움
+ - 하드웨어 의존성이 없어서 PC 에서도 그대로 컴파일 가능
+ ***/
+#ifndef COLOR_H
+#define COLOR_H
+
+#include <stdint.h>
+
+#define COLOR_ONE 4096      // 1.0 (Q12)
+#define COLOR_HUE_MAX 360   // 색상: 0 ~ 359 (도)
+#define COLOR_PERCENT 100   // 채도, 밝기: 0 ~ 100 (%)
+
+typedef struct {
+    uint16_t r, g, b;       // 0 ~ COLOR_ONE
+} color_rgb_t;
+
+void color_hsv_to_rgb(uint16_t hue, uint8_t sat, uint8_t val, color_rgb_t *out);
+void color_cct_to_rgb(uint16_t kelvin, uint8_t val, color_rgb_t *out);
+
+#endif /* COLOR_H */
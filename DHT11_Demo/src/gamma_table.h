@@ -0,0 +1,74 @@
+/* tools/gamma_table.py 로 생성 (직접 수정하지 말 것) */
+#ifndef GAMMA_TABLE_H
+#define GAMMA_TABLE_H
+
+#define GAMMA_TABLE_PERIOD 1000
+#define GAMMA_TABLE_GAMMA 2.2
+
+// table[d] = floor((d / 1000) ^ (1 / 2.2) * 1000), d = 0 ~ 1000
+#define GAMMA_TABLE_VALUES \
+       0,   43,   59,   71,   81,   89,   97,  104,  111,  117,  123,  128,  133,  138,  143,  148, \
+     152,  156,  161,  165,  168,  172,  176,  180,  183,  186,  190,  193,  196,  200,  203,  206, \
+     209,  212,  215,  217,  220,  223,  226,  228,  231,  234,  236,  239,  241,  244,  246,  249, \
+     251,  253,  256,  258,  260,  263,  265,  267,  269,  271,  274,  276,  278,  280,  282,  284, \
+     286,  288,  290,  292,  294,  296,  298,  300,  302,  304,  306,  308,  309,  311,  313,  315, \
+     317,  319,  320,  322,  324,  326,  327,  329,  331,  333,  334,  336,  338,  339,  341,  343, \
+     344,  346,  347,  349,  351,  352,  354,  355,  357,  358,  360,  362,  363,  365,  366,  368, \
+     369,  371,  372,  374,  375,  377,  378,  380,  381,  382,  384,  385,  387,  388,  390,  391, \
+     392,  394,  395,  396,  398,  399,  401,  402,  403,  405,  406,  407,  409,  410,  411,  413, \
+     414,  415,  417,  418,  419,  420,  422,  423,  424,  425,  427,  428,  429,  431,  432,  433, \
+     434,  435,  437,  438,  439,  440,  442,  443,  444,  445,  446,  448,  449,  450,  451,  452, \
+     453,  455,  456,  457,  458,  459,  460,  462,  463,  464,  465,  466,  467,  468,  470,  471, \
+     472,  473,  474,  475,  476,  477,  478,  480,  481,  482,  483,  484,  485,  486,  487,  488, \
+     489,  490,  491,  493,  494,  495,  496,  497,  498,  499,  500,  501,  502,  503,  504,  505, \
+     506,  507,  508,  509,  510,  511,  512,  513,  514,  515,  516,  517,  518,  519,  520,  521, \
+     522,  523,  524,  525,  526,  527,  528,  529,  530,  531,  532,  533,  534,  535,  536,  537, \
+     538,  539,  540,  541,  542,  543,  543,  544,  545,  546,  547,  548,  549,  550,  551,  552, \
+     553,  554,  555,  556,  557,  557,  558,  559,  560,  561,  562,  563,  564,  565,  566,  566, \
+     567,  568,  569,  570,  571,  572,  573,  574,  575,  575,  576,  577,  578,  579,  580,  581, \
+     582,  582,  583,  584,  585,  586,  587,  588,  588,  589,  590,  591,  592,  593,  594,  594, \
+     595,  596,  597,  598,  599,  599,  600,  601,  602,  603,  604,  604,  605,  606,  607,  608, \
+     609,  609,  610,  611,  612,  613,  614,  614,  615,  616,  617,  618,  618,  619,  620,  621, \
+     622,  622,  623,  624,  625,  626,  626,  627,  628,  629,  630,  630,  631,  632,  633,  634, \
+     634,  635,  636,  637,  637,  638,  639,  640,  641,  641,  642,  643,  644,  644,  645,  646, \
+     647,  647,  648,  649,  650,  651,  651,  652,  653,  654,  654,  655,  656,  657,  657,  658, \
+     659,  660,  660,  661,  662,  663,  663,  664,  665,  666,  666,  667,  668,  669,  669,  670, \
+     671,  671,  672,  673,  674,  674,  675,  676,  677,  677,  678,  679,  679,  680,  681,  682, \
+     682,  683,  684,  684,  685,  686,  687,  687,  688,  689,  689,  690,  691,  692,  692,  693, \
+     694,  694,  695,  696,  697,  697,  698,  699,  699,  700,  701,  701,  702,  703,  703,  704, \
+     705,  706,  706,  707,  708,  708,  709,  710,  710,  711,  712,  712,  713,  714,  714,  715, \
+     716,  717,  717,  718,  719,  719,  720,  721,  721,  722,  723,  723,  724,  725,  725,  726, \
+     727,  727,  728,  729,  729,  730,  731,  731,  732,  733,  733,  734,  735,  735,  736,  736, \
+     737,  738,  738,  739,  740,  740,  741,  742,  742,  743,  744,  744,  745,  746,  746,  747, \
+     748,  748,  749,  749,  750,  751,  751,  752,  753,  753,  754,  755,  755,  756,  756,  757, \
+     758,  758,  759,  760,  760,  761,  762,  762,  763,  763,  764,  765,  765,  766,  767,  767, \
+     768,  768,  769,  770,  770,  771,  772,  772,  773,  773,  774,  775,  775,  776,  776,  777, \
+     778,  778,  779,  780,  780,  781,  781,  782,  783,  783,  784,  784,  785,  786,  786,  787, \
+     787,  788,  789,  789,  790,  790,  791,  792,  792,  793,  793,  794,  795,  795,  796,  796, \
+     797,  798,  798,  799,  799,  800,  801,  801,  802,  802,  803,  804,  804,  805,  805,  806, \
+     807,  807,  808,  808,  809,  809,  810,  811,  811,  812,  812,  813,  814,  814,  815,  815, \
+     816,  816,  817,  818,  818,  819,  819,  820,  821,  821,  822,  822,  823,  823,  824,  825, \
+     825,  826,  826,  827,  827,  828,  829,  829,  830,  830,  831,  831,  832,  833,  833,  834, \
+     834,  835,  835,  836,  836,  837,  838,  838,  839,  839,  840,  840,  841,  842,  842,  843, \
+     843,  844,  844,  845,  845,  846,  847,  847,  848,  848,  849,  849,  850,  850,  851,  851, \
+     852,  853,  853,  854,  854,  855,  855,  856,  856,  857,  858,  858,  859,  859,  860,  860, \
+     861,  861,  862,  862,  863,  864,  864,  865,  865,  866,  866,  867,  867,  868,  868,  869, \
+     869,  870,  871,  871,  872,  872,  873,  873,  874,  874,  875,  875,  876,  876,  877,  877, \
+     878,  879,  879,  880,  880,  881,  881,  882,  882,  883,  883,  884,  884,  885,  885,  886, \
+     886,  887,  887,  888,  889,  889,  890,  890,  891,  891,  892,  892,  893,  893,  894,  894, \
+     895,  895,  896,  896,  897,  897,  898,  898,  899,  899,  900,  900,  901,  902,  902,  903, \
+     903,  904,  904,  905,  905,  906,  906,  907,  907,  908,  908,  909,  909,  910,  910,  911, \
+     911,  912,  912,  913,  913,  914,  914,  915,  915,  916,  916,  917,  917,  918,  918,  919, \
+     919,  920,  920,  921,  921,  922,  922,  923,  923,  924,  924,  925,  925,  926,  926,  927, \
+     927,  928,  928,  929,  929,  930,  930,  931,  931,  932,  932,  933,  933,  934,  934,  935, \
+     935,  936,  936,  937,  937,  938,  938,  939,  939,  940,  940,  941,  941,  942,  942,  943, \
+     943,  944,  944,  945,  945,  945,  946,  946,  947,  947,  948,  948,  949,  949,  950,  950, \
+     951,  951,  952,  952,  953,  953,  954,  954,  955,  955,  956,  956,  957,  957,  958,  958, \
+     958,  959,  959,  960,  960,  961,  961,  962,  962,  963,  963,  964,  964,  965,  965,  966, \
+     966,  967,  967,  968,  968,  968,  969,  969,  970,  970,  971,  971,  972,  972,  973,  973, \
+     974,  974,  975,  975,  976,  976,  976,  977,  977,  978,  978,  979,  979,  980,  980,  981, \
+     981,  982,  982,  983,  983,  983,  984,  984,  985,  985,  986,  986,  987,  987,  988,  988, \
+     989,  989,  989,  990,  990,  991,  991,  992,  992,  993,  993,  994,  994,  994,  995,  995, \
+     996,  996,  997,  997,  998,  998,  999,  999, 1000
+
+#endif /* GAMMA_TABLE_H */
@@ -1,8 +1,20 @@
 #include "hal_data.h"
-#include <stdio.h>
+#include "ring_buf.h"
+#include "adc_block.h"
+#include "light_filter.h"
+#include "gamma_table.h"
+#include "color.h"
+#include "rgb_dither.h"
+#include "rgb_sync.h"
+#include "timer_wheel.h"
+#include "task.h"
+#include "led_timer.h"
+#include "uart_tx.h"
+#include "uart_rx_ring.h"
+#include "cmd_parser.h"
+#include "bin_proto.h"
 #include <string.h>
 #include <stdarg.h> // 가변인자 함수
-#include <ctype.h> // isdigit()
 
 FSP_CPP_HEADER
 void R_BSP_WarmStart(bsp_warm_start_event_t event);
@@ -31,75 +43,343 @@ FSP_CPP_FOOTER
 fsp_err_t err;
 
 /*** UART (Serial 통신) ***/
-#define UART_TX_BUF_SIZE 50
-#define UART_RX_BUF_SIZE 30
-char g_tx_buffer[UART_TX_BUF_SIZE];
 volatile uint8_t g_uart_index = 0;  // 버퍼에 데이터가 쌓이는 위치
 
-#define END_CHARACTER   '\r'        // 명령어 종료를 나타내는 문자
-#define HEADER          "HDR"       // 헤더: 패킷 시작
-#define TAIL            "TAIL"      // 테일: 패킷 끝
-volatile uint8_t g_rx_buffer[UART_TX_BUF_SIZE] = {0};
-volatile uint16_t g_rx_index = 0;
+/*** 명령어 파서 (cmd_parser.c) ***/
+cmd_parser_t g_cmd_parser;
+
+// 명령어 인자 형식
+typedef enum {
+    CMD_ARG_NONE,           // 인자 없음        (예: S, ON)
+    CMD_ARG_NUMBER,         // 숫자            (예: R50)
+    CMD_ARG_ONOFF,          // ON/OFF          (예: AON)
+    CMD_ARG_NUMBER_ONOFF,   // 숫자 + ON/OFF   (예: T10ON)
+    CMD_ARG_NUMBER_FADE     // 숫자 (+ 페이드) (예: R50, R50F2000)
+} cmd_arg_t;
+
+// 명령어 테이블 항목 (COMMAND_LIST 참고)
+typedef struct {
+    const char *name;                       // 명령어 이름 (첫 글자 = opcode)
+    uint8_t name_len;
+    cmd_arg_t args;                         // 인자 형식
+    void (*handler)(uint32_t value, _Bool on);
+    const char *help;                       // 도움말 (command_err_handle() 에서 출력)
+} command_desc_t;
+
+/*** 바이너리 프로토콜 (PC 자동화 프로그램용, bin_proto.c) ***/
+bin_rx_t g_bin_rx;
+tw_timer_t g_bin_rx_timer;                  // 바이트 간 시간 초과 (바이너리 세션 중 바이트마다 다시 시작)
+volatile _Bool g_bin_rx_timeout = false;    // 시간 초과 발생 (process_command() 에서 처리)
+cmd_parser_t g_bin_cmd_parser;  // 바이너리 요청용 파서 (ASCII 파서 상태와 분리)
+_Bool g_uart_quiet = false;     // true: uart_write() 출력 안 함 (바이너리 요청 실행 중)
+
+/*** UART 수신 링버퍼 (SPSC: UART 인터럽트가 쓰고, main loop 가 읽음, uart_rx_ring.h) ***/
+uart_rx_ring_t g_uart_rx_ring;
+
+/*** UART 송신 링버퍼 (SPSC: main loop 가 쓰고, UART TX 인터럽트가 비움, uart_tx.c) ***/
+// uart_write() 는 링버퍼에 복사만 하고 바로 반환 > 전송 완료를 기다리지 않음
+uart_tx_ring_t g_uart_tx_ring;
+
+/*** UART 토큰 로그 모드 ***/
+// 1 이면 uart_write() 가 문자열 대신 [0xFE][문자열 주소 3바이트][변수 2바이트] (6바이트) 만 송신 (uart_tx_log)
+// 문자열 주소 = 플래시(.rodata) 에 있는 문자열 상수의 주소 > ELF 파일 자체가 문자열 테이블
+// PC 에서는 tools/uart_log_decode.py 로 ELF 를 읽어서 원래 문자열로 복원
+// 텍스트 그대로 나가는 출력: 예약 카운트다운 (write_time, 커서 이동 + mm:ss), 바이너리 응답 (bin_send_reply)
+#define UART_LOG_TOKENIZED 0
+
+/*** UART 송신 DTC 모드 ***/
+// FSP Configuration 에서 DTC Transfer(r_dtc, 트리거 SCI0_TXI) 를 추가하고 SCI_UART_CFG_DTC_SUPPORTED 를 켠 뒤
+// UART_TX_TRANSFER 를 그 인스턴스 주소 (예: &g_transfer_uart_tx) 로 바꾸면, uart_init() 에서 p_transfer_tx 로 연결
+// > R_SCI_UART_Write 한 번을 DTC 가 통째로 보내고, 끝날 때 인터럽트만 발생 (바이트마다 TXI 인터럽트 없음)
+// 연결하지 않거나 열기에 실패하면, 기존처럼 TXI 인터럽트로 1바이트씩 송신 (링버퍼 코드는 두 모드 모두 동일)
+#define UART_TX_TRANSFER NULL
 
 volatile _Bool g_uart_tx_complete = false;  // 비동기 전송 플래그 (초기값: true)
-volatile _Bool g_uart_rx_complete = false;  // 비동기 전송 플래그 (초기값: true)
 volatile _Bool g_scan_complete = false;     // ADC SCAN 완료 플래그
 
-volatile _Bool g_uart_tick_output_flag = false;
-volatile int g_new_minutes = 0;
-volatile int g_new_seconds = 0;
-#define NO_VAR 65535 // UART 변수 출력 여부 (uint16_t 의 최댓값:65535 이면 변수 출력 X)
+#define NO_VAR UART_TX_NO_VAR // UART 변수 출력 여부 (uint16_t 의 최댓값:65535 이면 변수 출력 X)
 
 /*** ADC (Analog to Digital Converter ***/
 uint16_t g_adc_data; // ADC 조도센서 데이터
-#define ADC_BUFFER_SIZE 60
+#define ADC_BUFFER_SIZE_LOG2 3 // 블록 평균(100ms) 8개 = 0.8초 이동 평균
 #define ADC_THRESHOLD_HIGH 3000
 #define ADC_THRESHOLD_LOW 1000
 
+// 조도센서 이동 평균 (ring_buf.h, 평균만 유지 > 최솟값/최댓값/분산은 ADC 명령어에서 훑어서 계산)
+RING_BUF_DEFINE_MEAN(adc_avg_buf, uint16_t, ADC_BUFFER_SIZE_LOG2)
+adc_avg_buf_t g_adc_buffer;
+
+/*** ADC 하드웨어 트리거 (GPT1 > ELC > ADC0) ***/
+// 1: GPT1 오버플로우 이벤트를 ELC 로 ADC0 에 연결 > 일정한 주기로 스캔 시작, 결과는 adc_callback 에서 수집
+// 0: 기존처럼 메인 루프에서 소프트웨어 ScanStart (스캔 완료 후에만 읽음)
+#define ADC_HW_TRIGGER 1
+#define ADC_SAMPLE_RATE_HZ 640    // 하드웨어 트리거 샘플링 주기 (Hz) : 블록 1개 = 64 / 640 = 100ms
+#define ADC_SAMPLE_TIMER_CHANNEL 1 // 샘플링 타이머 GPT 채널 (PWM 출력 핀 없음)
+
+/*** ADC 블록 수집 (핑퐁 버퍼, adc_block.h) ***/
+// 콜백이 한 블록을 채우는 동안 메인 루프는 다른(완성된) 블록을 처리
+// 메인 루프가 블록 하나(100ms) 이상 밀리면, 처리 안 된 블록은 보존하고 새로 채운 블록을 버림
+adc_block_buf_t g_adc_blocks;
+_Bool g_adc_hw_trigger = false; // true: 하드웨어 트리거로 동작 중 (adc_init 에서 설정)
+
+// 생성된 설정(ra_gen)은 그대로 두고, 트리거/오버샘플링만 바꾼 복사본으로 ADC 를 연다
+adc_extended_cfg_t g_adc_run_cfg_extend;
+adc_cfg_t g_adc_run_cfg;
+adc_channel_cfg_t g_adc_run_channel_cfg;
+
+/*** ADC 하드웨어 오버샘플링 (채널 0, ADADC/ADADS) ***/
+// 변환 1회에 여러 번 샘플링해서 ADC 가 직접 평균/덧셈 (CPU 부담 없음)
+// ADC12 는 평균을 2/4회까지만 지원 > 16회는 덧셈 모드 (결과 16비트, scale 로 나눠서 12비트 기준으로 맞춤)
 typedef struct {
-    uint16_t buffer[ADC_BUFFER_SIZE];
-    int head;       // 가장 오래된 데이터의 인덱스
-    int tail;       // 다음 데이터가 저장될 인덱스
-    int count;      // 현재 버퍼에 저장된 데이터 수
-    uint32_t sum;   // 버퍼의 데이터 합계
-} ring_buf_t;
-ring_buf_t g_adc_buffer;
-
-/*** USER BUTTON ***/
-bsp_io_level_t g_color_btn_level; // 색깔 변경 버튼 상태 (HIGH or LOW)
-bsp_io_level_t g_brightness_btn_level; // 밝기 변경 버튼 상태 (HIGH or LOW)
+    uint8_t count;      // 샘플 횟수 (명령어 인자)
+    adc_add_t add;      // ADADC 설정
+    uint8_t scale;      // 결과를 12비트 기준으로 맞추기 위해 나눌 값
+    uint8_t scale_log2; // log2(scale)
+} adc_oversample_t;
+const adc_oversample_t g_adc_oversample_modes[] = {
+    {  1, ADC_ADD_OFF,           1, 0 },
+    {  2, ADC_ADD_AVERAGE_TWO,   1, 0 },
+    {  4, ADC_ADD_AVERAGE_FOUR,  1, 0 },
+    { 16, ADC_ADD_SIXTEEN,      16, 4 },
+};
+#define ADC_OVERSAMPLE_MODE_COUNT (sizeof(g_adc_oversample_modes) / sizeof(g_adc_oversample_modes[0]))
+#define ADC_OVERSAMPLE_DEFAULT 2 // 4회 평균
+uint8_t g_adc_oversample = ADC_OVERSAMPLE_DEFAULT; // g_adc_oversample_modes 번호
+
+/*** 자동 조명 : ADC 윈도우 비교 (Window A, 채널 0) ***/
+// ADC 가 변환할 때마다 하드웨어로 기준값과 비교 > 밝기 구간이 바뀐 경우에만 이벤트 (메인 루프에서 기준값 비교 X)
+//   어두움: "값 > LOW + 히스테리시스" 를 기다림
+//   중간  : "값 < LOW 또는 값 > HIGH" (윈도우 밖) 를 기다림
+//   밝음  : "값 < HIGH - 히스테리시스" 를 기다림
+// 구간이 바뀌면 adc_callback 에서 바로 다음 비교 조건으로 다시 설정
+// (윈도우 비교 인터럽트 벡터가 없어도 동작: 이미 발생하는 스캔 완료 인터럽트에서 비교 결과 플래그 확인)
 typedef enum {
-    WAITING_FOR_PRESS,  // Click 을 기다림 : 버튼을 누른 상태       (LOW)
-    WAITING_FOR_RELEASE // 손 떼기를 기다림  : 버튼을 누르지 않은 상태 (HIGH)
-} ButtonState;
-ButtonState g_color_btn_state = WAITING_FOR_PRESS; // 누르지 않은 상태
-ButtonState g_brightness_btn_state = WAITING_FOR_PRESS; // 누르지 않은 상태
+    LIGHT_ZONE_DARK,    // 어두움 (<= LOW) > LED 켜기
+    LIGHT_ZONE_MID,     // 중간 > LED 조금 어둡게
+    LIGHT_ZONE_BRIGHT   // 밝음 (>= HIGH) > LED 끄기
+} light_zone_t;
+#define ADC_WINDOW_HYSTERESIS 50 // 구간을 벗어날 때의 히스테리시스 (12비트 기준)
+#define ADC_MAX_VALUE 4095
+uint16_t g_light_threshold_low = ADC_THRESHOLD_LOW;   // 12비트 기준 (명령어로 변경 가능)
+uint16_t g_light_threshold_high = ADC_THRESHOLD_HIGH;
+volatile light_zone_t g_light_zone = LIGHT_ZONE_MID;  // 윈도우 비교 기준 구간 (시작은 중간으로 가정, 실제 구간은 tasks_init 에서 한 번 확인)
+volatile _Bool g_adc_window_hit = false; // 윈도우 비교 인터럽트가 연결된 경우 (ADC_EVENT_WINDOW_COMPARE_A)
+volatile uint16_t g_adc_sample;          // 소프트웨어 트리거: 콜백에서 읽은 마지막 변환 결과
+// 윈도우 비교는 깨우기만 하고, 구간 결정은 필터 출력으로 (조명 깜빡임으로 LED 가 바뀌지 않도록)
+#define LIGHT_SETTLE_BLOCKS 3    // 윈도우 이벤트 후 필터 출력으로 구간을 확인할 블록 수 (300ms)
+light_zone_t g_light_applied_zone = LIGHT_ZONE_MID; // auto_on_off() 에 마지막으로 적용한 구간
+_Bool g_light_force = false;     // 구간이 같아도 다시 적용 (부팅, AON), 확인 블록이 끝난 뒤 적용
+adc_window_cfg_t g_adc_window_cfg = {
+    .compare_mask = ADC_MASK_CHANNEL_0,
+    .compare_mode_mask = 0,
+    .compare_cfg = (adc_compare_cfg_t)(ADC_COMPARE_CFG_A_ENABLE | ADC_COMPARE_CFG_WINDOW_ENABLE),
+    .compare_ref_low = ADC_THRESHOLD_LOW,
+    .compare_ref_high = ADC_THRESHOLD_HIGH,
+};
+
+/*** 조도센서 필터 (노치 + 저역통과 + 데시메이션, light_filter.c) ***/
+// 0: 블록 단순 평균 (이전 방식)
+#define LIGHT_FILTER_ENABLE 1
+#if LIGHT_FILTER_ENABLE && (LIGHT_FILTER_FS_HZ != ADC_SAMPLE_RATE_HZ || LIGHT_FILTER_DECIMATION != ADC_BLOCK_SIZE)
+#error "샘플링 주파수/블록 크기가 바뀌면 필터 계수를 다시 생성해야 함 (tools/filter_coeffs.py --fs --taps)"
+#endif
+light_filter_t g_light_filter;
+
+// 샘플링 타이머: 주기 카운트는 adc_sample_timer_init() 에서 클럭으로 계산
+gpt_instance_ctrl_t g_adc_timer_ctrl;
+const gpt_extended_cfg_t g_adc_timer_extend = {
+    .gtioca = { .output_enabled = false, .stop_level = GPT_PIN_LEVEL_LOW },
+    .gtiocb = { .output_enabled = false, .stop_level = GPT_PIN_LEVEL_LOW },
+    .start_source = GPT_SOURCE_NONE,
+    .stop_source = GPT_SOURCE_NONE,
+    .clear_source = GPT_SOURCE_NONE,
+    .count_up_source = GPT_SOURCE_NONE,
+    .count_down_source = GPT_SOURCE_NONE,
+    .capture_a_source = GPT_SOURCE_NONE,
+    .capture_b_source = GPT_SOURCE_NONE,
+    .capture_a_ipl = BSP_IRQ_DISABLED,
+    .capture_b_ipl = BSP_IRQ_DISABLED,
+    .capture_a_irq = FSP_INVALID_VECTOR,
+    .capture_b_irq = FSP_INVALID_VECTOR,
+    .capture_filter_gtioca = GPT_CAPTURE_FILTER_NONE,
+    .capture_filter_gtiocb = GPT_CAPTURE_FILTER_NONE,
+    .p_pwm_cfg = NULL,
+    .gtior_setting.gtior = 0U,
+};
+const timer_cfg_t g_adc_timer_cfg = {
+    .mode = TIMER_MODE_PERIODIC,
+    .period_counts = 0x10000,
+    .duty_cycle_counts = 0,
+    .source_div = (timer_source_div_t) 0,
+    .channel = ADC_SAMPLE_TIMER_CHANNEL,
+    .p_callback = NULL,   // 인터럽트 없이 ELC 이벤트만 사용
+    .p_context = NULL,
+    .p_extend = &g_adc_timer_extend,
+    .cycle_end_ipl = BSP_IRQ_DISABLED,
+    .cycle_end_irq = FSP_INVALID_VECTOR,
+};
 
+/*** USER BUTTON ***/
+// PRESS > RELEASE 를 기다리는 태스크 (button_task), 버튼마다 하나
 int g_color_btn_cnt = 0; // 색상 변경 버튼 클릭 횟수
 int g_brightness_btn_cnt = 0;   // 밝기 변경 버튼 클릭 횟수
 
 /*** RGB LED : GPT ***/
+// 명령어 프레임 하나 동안 모은 R/G/B 듀티 변경 (led_txn_commit() 에서 한 번에 적용)
+typedef struct {
+    uint32_t duty[3];   // R, G, B (RGB_FINE 단위)
+    uint8_t changed;    // 변경된 채널 (bit0: R, bit1: G, bit2: B)
+    uint32_t fade_ms;   // 페이드 시간 (프레임 안에서 마지막으로 지정한 값, 없으면 0 = 바로 변경)
+} led_txn_t;
+led_txn_t g_led_txn;
+
+// 설정된(목표) 듀티 : 페이드 중에도 목표값 (PWM 에 지금 나가는 값은 g_rgb_output)
 uint32_t g_R_LED_duty_cycle = 0;
 uint32_t g_G_LED_duty_cycle = 0;
 uint32_t g_B_LED_duty_cycle = 0;
+uint32_t g_rgb_output[3]; // 지금 PWM 에 설정된 R/G/B 듀티 (카운트)
+
+/*** 색 엔진 : HSV / 색온도 > R/G/B 듀티 (color.c, 정수 연산) ***/
+// 색 > 밝기 단계(Q12) > 감마 보정(테이블) > 화이트 밸런스 > 듀티
+typedef enum {
+    COLOR_MODE_HSV,     // 색상/채도/밝기 (U, Y, V 명령어)
+    COLOR_MODE_CCT      // 색온도/밝기    (K, V 명령어)
+} color_mode_t;
+typedef struct {
+    color_mode_t mode;
+    uint16_t hue;       // 색상 0 ~ 359
+    uint8_t sat;        // 채도 0 ~ 100
+    uint8_t val;        // 밝기 0 ~ 100 (두 모드 공용)
+    uint16_t kelvin;    // 색온도 (K)
+} color_state_t;
+color_state_t g_color = { COLOR_MODE_CCT, 0, 100, 100, 4000 };
+// 화이트 밸런스: 채널별 최대 듀티 (%), LED 색마다 밝기가 달라서 흰색/색온도가 맞게 보이도록 보정 (W 명령어)
+uint8_t g_white_balance[3] = { 100, 100, 100 };
 _Bool g_is_RGB_LED_ON_by_cmd = false;
-#define GAMMA 2.2 // 감마 보정 의 일반적인 감마 값
 
 // [데이터 시트] RGB LED 0V ~ 5V
 // http://wiki.sunfounder.cc/index.php?title=RGB_LED_Module
 //#define MAX_VOLTAGE 5.0
 
 #define RGB_PWM_PERIOD 1000 // 단위: micro seconds (FSP Configuration)
-volatile _Bool g_timer_set = false;
-volatile uint64_t g_timer_target_ticks = 0;
-volatile uint64_t g_new_tick = 0; // 타이머 설정 틱
-volatile uint64_t g_old_tick = 0; // 프로그램 실행부터 지금까지 전체 틱
-#define TICK_PER_ONE_SEC 100000
+
+/*** RGB PWM 동기화 (GPT3: R, GPT4: G, GPT6: B) ***/
+// 세 타이머는 같은 클럭/주기로, 카운터 클리어와 시작을 한 번의 레지스터 쓰기로 > 주기 끝(버퍼 전송 시점)이 항상 같음
+#define RGB_PWM_CHANNEL_MASK (g_timer3_ctrl.channel_mask | g_timer4_ctrl.channel_mask | g_timer6_ctrl.channel_mask)
+#define RGB_SYNC_WRITE_LIMIT (RGB_PWM_PERIOD / 2) // 듀티 쓰기는 카운터가 이 값 이하일 때 시작 (세 채널 쓰기가 한 주기 안에 끝나도록)
+#define RGB_SYNC_GUARD 50                          // 주기 끝까지 이만큼(카운트)도 안 남았으면 다음 주기에 버퍼 전송 허용
+rgb_sync_t g_rgb_sync; // 세 타이머 레지스터 (rgb_sync.h, 타이머를 연 뒤 초기화)
+timer_cfg_t g_timer4_run_cfg; // G/B 타이머 실행 설정 (R 타이머와 같은 클럭 분주, 오버플로우 인터럽트 없음)
+timer_cfg_t g_timer6_run_cfg;
+
+/*** RGB LED 디더링 (1차 시그마-델타) ***/
+// 듀티는 내부적으로 fine 단위 (rgb_dither.h)
+// 디더링 ON: GPT3 오버플로우(PWM 한 주기) 마다 base / base+1 카운트를 섞어서, 평균 듀티가 fine 값이 되도록
+//           1000 카운트 x 64 = 64000 단계 (약 16비트), PWM 주파수는 그대로
+//           세 채널 모두 소수 부분(fine 하위 비트) 이 0 이면 섞을 것이 없으므로 인터럽트를 끄고 바로 출력
+//           > 고정된 정수 듀티에서는 인터럽트 비용 없음 (디더링이 필요한 어두운 밝기/페이드 중에만 동작)
+// 디더링 OFF: fine 값을 가장 가까운 카운트로 반올림 (기존과 같음)
+uint32_t g_rgb_fine[3];            // 출력할 R/G/B 듀티 (fine, 페이드 중에는 중간값)
+uint32_t g_rgb_dither_acc[3];      // 시그마-델타 누적 오차 (GPT3 콜백 전용)
+volatile _Bool g_rgb_dither = false; // 디더링 ON/OFF (명령어 D)
+_Bool g_rgb_dither_irq = false;    // GPT3 주기 끝 인터럽트 켜짐 (디더링 ON 이고 소수 부분이 있는 채널이 있을 때만)
+
+/*** RGB LED 페이드 ***/
+// 지금 출력 중인 듀티 > 목표 듀티로, 지정한 시간 동안 이징 곡선을 따라 변경
+// 타이머 휠(g_fade_timer) 에서 RGB_FADE_STEP_HZ 마다 한 단계 > 메인 루프(100ms) 가 밀려도 일정한 속도
+#define RGB_FADE_STEP_HZ 200
+#define RGB_FADE_TICKS_PER_STEP (TICK_PER_ONE_SEC / RGB_FADE_STEP_HZ)
+#define RGB_FADE_DEFAULT_MS 500 // 자동 조명 / 버튼 / 타이머 / ON, OFF 명령어의 페이드 시간
+#define RGB_FADE_Q16_ONE 65536U // 진행률/이징 값의 1.0 (Q16)
+typedef enum {
+    FADE_EASE_LINEAR,   // 일정한 속도
+    FADE_EASE_IN,       // 천천히 시작 (p^2)
+    FADE_EASE_OUT,      // 천천히 끝남 (1 - (1-p)^2)
+    FADE_EASE_IN_OUT,   // 천천히 시작하고 천천히 끝남 (3p^2 - 2p^3)
+    FADE_EASE_COUNT
+} fade_ease_t;
+typedef struct {
+    uint32_t from[3];           // 시작 듀티 (R, G, B, fine)
+    uint32_t to[3];             // 목표 듀티 (fine)
+    uint32_t steps;             // 전체 단계 수
+    uint32_t step;              // 지금까지 진행한 단계 수
+    fade_ease_t ease;
+    volatile _Bool active;      // 페이드 중 (시스템 틱이 단계 진행)
+} rgb_fade_t;
+rgb_fade_t g_rgb_fade;
+fade_ease_t g_fade_ease = FADE_EASE_IN_OUT; // 다음 페이드에 쓸 곡선 (명령어 C)
+tw_timer_t g_fade_timer;                    // 페이드 중에만 RGB_FADE_TICKS_PER_STEP 마다 (타이머 휠)
+
+// 감마 보정 테이블 (감마 2.2, tools/gamma_table.py 로 생성 > gamma_table.h)
+#if GAMMA_TABLE_PERIOD != RGB_PWM_PERIOD
+#error "RGB_PWM_PERIOD 가 바뀌면 감마 테이블을 다시 생성해야 함 (tools/gamma_table.py --period)"
+#endif
+const uint16_t g_gamma_table[RGB_PWM_PERIOD + 1] = { GAMMA_TABLE_VALUES };
+
+/*** 시스템 틱 (SysTick) : 타이머 휠 구동 (LED ON/OFF 예약, 카운트다운 출력, LED 페이드) ***/
+// PWM 타이머(GPT3/4/6) 오버플로우 인터럽트(주기마다 100kHz) 는 쓰지 않음 (디더링 ON 일 때만 GPT3)
+// SysTick 우선순위는 GPT3 인터럽트와 같게 > 서로 끼어들지 않음 (페이드/디더링이 같은 출력 값을 씀)
+#define SYSTEM_TICK_HZ 1000
+#define TICK_PER_ONE_SEC SYSTEM_TICK_HZ
 #define TICK_PER_ONE_MIN TICK_PER_ONE_SEC * 60
-/*** hal_entry() delay 값 ***/
-#define HAL_ENTRY_DELAY 100 // hal_entry() 내부 while 문의 delay
-#define SEC_UNIT 1000 / HAL_ENTRY_DELAY // 반복문 내에서 1초 단위로 맞춰주기 위함
+timer_wheel_t g_timer_wheel; // now = 부팅 후 전체 틱
+
+/*** ON/OFF 예약 타이머 (명령어 T) ***/
+#define LED_TIMER_MAX_MIN (24 * 60) // 최대 예약 시간 (분)
+
+/*** CPU 부하 측정 (DWT 사이클 카운터) ***/
+// 인터럽트(시스템 틱, GPT3 디더링) 안에서 쓴 사이클, 메인 루프가 잠든 사이클을 1초 동안 모아서 % 로 (명령어 CPU)
+// FSP 인터럽트 진입/복귀 사이클은 빠짐 (콜백/핸들러 본문만)
+typedef struct {
+    uint32_t busy;      // 이번 1초 동안 인터럽트에서 쓴 사이클
+    uint32_t last_busy; // 지난 1초 결과
+    uint32_t ticks;     // 1초 세기 (시스템 틱)
+    uint32_t irqs;      // 이번 1초 동안 인터럽트 횟수
+    uint32_t last_irqs; // 지난 1초 결과
+    uint32_t idle;      // 이번 1초 동안 메인 루프가 WFI 로 잠든 사이클
+    uint32_t last_idle; // 지난 1초 결과
+    uint32_t latency;      // 이번 1초 동안 UART 수신 > 명령어 처리 시작 최대 사이클
+    uint32_t last_latency; // 지난 1초 결과
+} cpu_load_t;
+cpu_load_t g_cpu_load;
+
+/*** 메인 루프 이벤트 (hal_entry) ***/
+// 인터럽트가 이벤트를 올리면 메인 루프가 해당 처리만 하고, 이벤트가 없으면 WFI 로 잠듦 (슬립 모드, SBYCR.SSBY = 0)
+#define EVENT_UART_RX     (1UL << 0) // UART 문자 수신 (uart_callback) > process_command()
+#define EVENT_ADC         (1UL << 1) // ADC 블록 완성 (하드웨어 트리거) 또는 샘플 주기 (소프트웨어 트리거) > adc_read(), light_task
+#define EVENT_LIGHT       (1UL << 2) // 밝기 구간이 바뀜 (adc_callback) 또는 자동모드 ON > light_task
+#define EVENT_TASK        (1UL << 3) // 태스크 타임아웃 / 양보 (task.c)
+#define EVENT_TIMER_SET   (1UL << 4) // 새 ON/OFF 예약 (set_timer) > led_timer_task
+#define EVENT_TIMER_RESET (1UL << 5) // 예약 취소 (명령어 S) > led_timer_task
+#define EVENT_BUTTON      (1UL << 6) // 버튼 값 읽음 (rt_buttons) > button_task
+#define EVENT_RT          (1UL << 7) // 주기 항목이 풀림 (rt_release_tick) > rt_dispatch()
+#define EVENT_COUNT 8
+volatile uint32_t g_events;
+uint32_t g_event_cycle[EVENT_COUNT]; // 이벤트 비트마다 처음 올린 시점 (DWT->CYCCNT, 지연 / 시작 지연 측정)
+#define ADC_SW_POLL_MS 100 // 소프트웨어 트리거 샘플 주기 (하드웨어 트리거는 블록마다 이벤트)
+tw_timer_t g_adc_poll_timer;
+
+/*** 태스크 (task.h, 주기 항목 "TASK" 에서 디스패치) ***/
+volatile uint8_t g_buttons_pressed; // 눌린 버튼 (비트 = 버튼 번호, rt_buttons 가 BUTTON_POLL_MS 마다 갱신)
+typedef struct {
+    task_t task;
+    bsp_io_port_pin_t pin;
+    uint16_t num;           // 1: 색상 변경 (S1), 2: 밝기 변경 (S2)
+} button_task_t;
+button_task_t g_color_btn_task = { .pin = BUTTON_S1, .num = 1 };
+button_task_t g_brightness_btn_task = { .pin = BUTTON_S2, .num = 2 };
+
+typedef struct {
+    task_t task;
+    uint8_t settle;         // 남은 확인 블록 수
+} light_task_t;
+light_task_t g_light_task;
+
+led_timer_task_t g_led_timer_task; // ON/OFF 예약 카운트다운 (led_timer.h)
+
+// 배열 순서 = 같은 이벤트에서 실행 순서
+task_t *const g_tasks[] = { &g_led_timer_task.task, &g_light_task.task, &g_color_btn_task.task, &g_brightness_btn_task.task };
+#define TASK_COUNT ((uint8_t)(sizeof(g_tasks) / sizeof(g_tasks[0])))
 
 /*** 버튼/명령어 수동 제어 여부 ***/
 volatile _Bool g_manual_control = false;
@@ -124,32 +404,148 @@ void Device_Init();
 void uart_init();
 void adc_init();
 void adc_callback(adc_callback_args_t * p_args);
-void ring_buf_init(ring_buf_t *rb);
-void ring_buf_push(ring_buf_t *rb, uint16_t data);
-uint16_t ring_buf_avg(ring_buf_t *rb);
 int adc_read();
+fsp_err_t adc_sample_timer_init();
+uint16_t adc_block_process(const uint16_t *block);
+void light_update(uint16_t filtered);
+fsp_err_t adc_open();
+fsp_err_t adc_set_oversample(uint8_t mode);
+void adc_window_arm(light_zone_t zone);
+void adc_window_check(uint16_t data);
+_Bool adc_window_set_thresholds(uint32_t low, uint32_t high);
 void gpt_open();
 void set_period(timer_ctrl_t * const p_ctrl, uint32_t const period_counts);
-void set_duty_cycle(timer_ctrl_t * const p_ctrl, uint32_t const duty_cycle);
 void start_gpt(timer_ctrl_t * const p_ctrl);
 void pwm_init();
+void pwm_sync_start();
+void set_rgb(uint32_t r_duty, uint32_t g_duty, uint32_t b_duty);
+void rgb_fade_to(uint32_t r_duty, uint32_t g_duty, uint32_t b_duty, uint32_t duration_ms);
+void rgb_fade_to_fine(const uint32_t to[3], uint32_t duration_ms);
+void rgb_output_fine(const uint32_t fine[3]);
+void rgb_dither_enable(_Bool on);
+void rgb_dither_irq(_Bool on);
+void rgb_dither_step();
+void rgb_fade_step();
+void system_tick_init();
+void system_tick();
+void led_timer_second(uint32_t remaining);
+void led_timer_expire();
+uint8_t light_task(task_t *t);
+uint8_t button_task(task_t *t);
+_Bool button_pressed(bsp_io_port_pin_t pin);
+void tasks_init();
+void rt_init();
+void rt_release(uint8_t index, uint32_t events, uint32_t cycle);
+void rt_release_tick(tw_timer_t *timer, void *arg);
+void rt_release_events(uint32_t events);
+void rt_dispatch();
+void rt_command(uint32_t events);
+void rt_buttons(uint32_t events);
+void rt_adc(uint32_t events);
+void rt_tasks(uint32_t events);
+void fade_timer_tick(tw_timer_t *timer, void *arg);
+void cpu_load_add(uint32_t start);
+void event_post(uint32_t events);
+uint32_t event_wait();
+void adc_poll_tick(tw_timer_t *timer, void *arg);
 void uart_callback(uart_callback_args_t *p_args);
 fsp_err_t uart_ep_demo(void); // 주의
 void uart_write(char *message, uint16_t var);
 void uart_read();
 void parse_command(char* data);
 void set_brightness(int level);
-void auto_on_off();
+void auto_on_off(light_zone_t zone);
 uint32_t gamma_correct_duty_cycle(uint32_t duty_cycle);
+uint32_t gamma_correct_fine(uint32_t fine);
 void set_duty_cycles_by_ratio(int n);
 void handle_btn_click(uint16_t btn_num);
 void write_duty_cycle();
-void check_btn_clicked(bsp_io_port_pin_t BUTTON, bsp_io_level_t g_btn_level, ButtonState* g_btn_state);
 uint32_t convert_brightness_to_duty_cycle(uint32_t brightness);
+void color_to_duty_cycles(const color_state_t *color, uint32_t duty[3]);
+void color_stage();
 void process_command();
+_Bool command_resolve(const command_t *cmd, const command_desc_t **p_desc, _Bool *p_on);
+_Bool execute_frame(const cmd_parser_t *p);
+bin_status_t bin_execute(const uint8_t *payload, uint8_t len);
+void bin_rx_timeout_tick(tw_timer_t *timer, void *arg);
+void led_txn_stage(uint8_t channel, uint32_t duty_cycle);
+void led_txn_commit();
+void command_table_init();
+void cmd_led_r(uint32_t value, _Bool on);
+void cmd_led_g(uint32_t value, _Bool on);
+void cmd_led_b(uint32_t value, _Bool on);
+void cmd_timer(uint32_t value, _Bool on);
+void cmd_timer_reset(uint32_t value, _Bool on);
+void cmd_auto(uint32_t value, _Bool on);
+void cmd_led_on(uint32_t value, _Bool on);
+void cmd_led_off(uint32_t value, _Bool on);
+void cmd_exit(uint32_t value, _Bool on);
+void cmd_oversample(uint32_t value, _Bool on);
+void cmd_light_low(uint32_t value, _Bool on);
+void cmd_adc_stats(uint32_t value, _Bool on);
+void cmd_filter_bench(uint32_t value, _Bool on);
+void cmd_light_high(uint32_t value, _Bool on);
+void cmd_fade_curve(uint32_t value, _Bool on);
+void cmd_cpu_load(uint32_t value, _Bool on);
+void cmd_rt_stats(uint32_t value, _Bool on);
+void cmd_dither(uint32_t value, _Bool on);
+void cmd_color_temp(uint32_t value, _Bool on);
+void cmd_color_hue(uint32_t value, _Bool on);
+void cmd_color_sat(uint32_t value, _Bool on);
+void cmd_color_val(uint32_t value, _Bool on);
+void cmd_white_balance_r(uint32_t value, _Bool on);
+void cmd_white_balance_g(uint32_t value, _Bool on);
+void cmd_white_balance_b(uint32_t value, _Bool on);
 void command_err_handle();
 void g_timer_callback(timer_callback_args_t *p_args);
 void set_timer(uint32_t minutes, _Bool led_on);
+void write_time(uint32_t sec);
+
+/***
+ 주기 항목 표 (rate-monotonic, 선점 없음)
+ - 표 순서 = 우선순위: 주기(마감) 가 짧은 항목을 앞에 (rate-monotonic)
+ - 주기 항목(periodic): 타이머 휠이 period_ms 마다 풀어줌 / 이벤트 항목: events 중 하나가 오면 풀림 (period_ms = 마감)
+ - rt_dispatch() 는 풀린 항목 중 가장 앞의 것 하나를 실행하고 다시 처음부터 확인 (실행 중에 앞 항목이 풀렸을 수 있음)
+ - 항목마다 실행 시간 (평균/최대), 시작 지연 (풀림 > 시작, 최소/최대 > 지터), 예산 초과, 마감 놓침을 기록 (명령어 P)
+   마감 놓침: 끝난 시점이 풀린 시점 + period_ms 보다 늦음, 또는 주기 항목이 실행 전에 다시 풀림
+   (다시 풀리면 밀린 주기를 한 번 놓침으로 세고 풀린 시점을 새 주기로 > 같은 늦음을 실행 끝에서 또 세지 않음)
+ ***/
+typedef struct {
+    const char *name;
+    uint32_t period_ms;         // 주기 / 마감 (ms)
+    uint32_t budget_us;         // 최악 실행 시간 예산 (us)
+    uint32_t events;            // 이 이벤트가 오면 풀림 (0: 주기로만)
+    _Bool periodic;             // true: period_ms 마다 풀림
+    void (*handler)(uint32_t events); // events: 풀어준 이벤트 (주기로 풀리면 0)
+} rt_task_cfg_t;
+
+#define BUTTON_POLL_MS 50 // 버튼 인터럽트(ICU) 가 없어 주기적으로 읽음 (채터링보다 길게)
+const rt_task_cfg_t g_rt_tasks[] = {
+    //  이름                               주기(ms)        예산(us) 이벤트         주기   핸들러
+    { "\033[36m[P0] CMD: 명령어 처리",   20,             2000,    EVENT_UART_RX, false, rt_command },
+    { "\033[36m[P1] BTN: 버튼 읽기",     BUTTON_POLL_MS, 50,      0,             true,  rt_buttons },
+    { "\033[36m[P2] ADC: 조도센서 블록", ADC_SW_POLL_MS, 3000,    EVENT_ADC,     false, rt_adc },
+    { "\033[36m[P3] TASK: 태스크",       100,            2000,    0xFFFFFFFFUL,  false, rt_tasks }, // 모든 이벤트
+};
+#define RT_TASK_COUNT ((uint8_t)(sizeof(g_rt_tasks) / sizeof(g_rt_tasks[0])))
+#define RT_STATS_RESET 9 // 명령어 P9: 통계 초기화
+
+typedef struct {
+    tw_timer_t timer;           // 주기 항목 풀어주기
+    volatile _Bool released;    // 실행 기다림
+    uint32_t release_cycle;     // 풀린 시점 (DWT->CYCCNT)
+    uint32_t events;            // 풀어준 이벤트 (모아서 handler 에 전달)
+    uint32_t deadline_cycles;   // 마감 (사이클, rt_init 에서 계산)
+    uint32_t budget_cycles;     // 예산 (사이클)
+    uint32_t runs;
+    uint64_t exec_sum;          // 실행 사이클 합 (평균)
+    uint32_t exec_max;
+    uint32_t latency_min;       // 풀림 > 시작 최소 (사이클, 실행 전에는 UINT32_MAX)
+    uint32_t latency_max;       // 풀림 > 시작 최대 (사이클)
+    uint32_t overruns;          // 예산 초과
+    uint32_t misses;            // 마감 놓침
+} rt_task_stat_t;
+rt_task_stat_t g_rt_stats[RT_TASK_COUNT];
 
 // ■ Delay function in microseconds
 void delay_us(uint32_t delay) {
@@ -169,6 +565,10 @@ void uart_callback(uart_callback_args_t *p_args){
         case UART_EVENT_TX_COMPLETE:
         {
             g_uart_tx_complete = true; // 송신 완료
+
+            // 송신 끝난 만큼 링버퍼 비우고, 남은 데이터 이어서 송신
+            uart_tx_complete(&g_uart_tx_ring);
+            if (g_bin_rx.pending) event_post(EVENT_UART_RX); // 바이너리 응답 자리를 기다리는 중 > 다시 처리
             break;
         }
 
@@ -176,18 +576,14 @@ void uart_callback(uart_callback_args_t *p_args){
         // 한 문자 수신 event
         case UART_EVENT_RX_CHAR:
         {
-            g_rx_buffer[g_rx_index++] = (uint8_t)p_args->data;
-            if ((uint8_t)p_args->data == END_CHARACTER || g_rx_index >= UART_RX_BUF_SIZE) {
-                g_rx_buffer[g_rx_index] = '\0'; // 종료 문자 추가
-                g_rx_index = 0;  // 인덱스 초기화
-                g_uart_rx_complete = true; // 수신 완료 플래그
-            }
+            // 링버퍼에 추가만 함 (명령어 해석은 process_command() 에서, 가득 차면 overrun)
+            uart_rx_push(&g_uart_rx_ring, (uint8_t)p_args->data);
+            event_post(EVENT_UART_RX);
             break;
         }
 
         // 아래 event는 버퍼가 모두 찼을 때만 호출된다.
         case UART_EVENT_RX_COMPLETE:
-            g_uart_rx_complete = true;
             break;
 
         // 이후 사용 안 할 이벤트 (컴파일 경고-e2studio 노란 줄-때문에 추가함)
@@ -196,6 +592,7 @@ void uart_callback(uart_callback_args_t *p_args){
         case UART_EVENT_ERR_FRAMING:
             break;
         case UART_EVENT_ERR_OVERFLOW:
+            g_uart_rx_ring.hw_overrun++;
             break;
         case UART_EVENT_BREAK_DETECT:
             break;
@@ -208,20 +605,35 @@ void uart_callback(uart_callback_args_t *p_args){
 // ■ UART 송신 (MCU > PC, Transmit)
 void uart_write(char *message, uint16_t var)
 {
-    if(var == NO_VAR) sprintf(g_tx_buffer, "%s\r\n\033[0m", message);
-    else snprintf(g_tx_buffer, UART_TX_BUF_SIZE, "%s: %u\r\n\033[0m", message, var);
-
+    if (g_uart_quiet) return; // 바이너리 요청 실행 중
+
+    // 링버퍼가 넘쳐서 버려진 바이트가 있으면, 먼저 알림
+    if (g_uart_tx_ring.dropped != g_uart_tx_ring.reported) {
+        uint32_t dropped = g_uart_tx_ring.dropped;
+        uint32_t count = dropped - g_uart_tx_ring.reported;
+        if (uart_tx_log(&g_uart_tx_ring, "\033[31mTX 초과 드롭", (uint16_t)((count < NO_VAR) ? count : NO_VAR - 1),
+                        UART_LOG_TOKENIZED)) {
+            g_uart_tx_ring.reported = dropped;
+        }
+    }
 
-    g_uart_tx_complete = false; // 플래그 초기화
-    R_SCI_UART_Write(&g_uart0_ctrl, (uint8_t *)g_tx_buffer, strlen(g_tx_buffer));
-    while (!g_uart_tx_complete) {} // 전송 완료될 때까지 대기
+    (void)uart_tx_log(&g_uart_tx_ring, message, var, UART_LOG_TOKENIZED); // 전송 완료를 기다리지 않음
 }
 
 
 
 // ■ UART 초기화
 void uart_init() {
-    R_SCI_UART_Open(&g_uart0_ctrl, &g_uart0_cfg);
+    uart_tx_init(&g_uart_tx_ring, &g_uart0); // 송신 링버퍼 초기화
+    memset(&g_uart_rx_ring, 0, sizeof(g_uart_rx_ring)); // 수신 링버퍼 초기화
+    cmd_parser_reset(&g_cmd_parser); // 명령어 파서 초기화
+    command_table_init();            // 명령어 테이블 인덱스 생성
+    bin_rx_reset(&g_bin_rx);         // 바이너리 프로토콜 수신 초기화
+#if SCI_UART_CFG_DTC_SUPPORTED
+    uart_tx_open(&g_uart_tx_ring, UART_TX_TRANSFER); // DTC 송신 연결 (실패하면 인터럽트 송신)
+#else
+    uart_tx_open(&g_uart_tx_ring, NULL);             // 드라이버에 DTC 지원이 없음
+#endif
     R_SCI_UART_CallbackSet(&g_uart0_ctrl, uart_callback, NULL, NULL); // 콜백 함수 등록
 
 }
@@ -230,86 +642,254 @@ void uart_init() {
 // ■ ADC 콜백 함수 구현
 void adc_callback(adc_callback_args_t * p_args)
 {
-    if (p_args->event == ADC_EVENT_SCAN_COMPLETE) {
-        g_scan_complete = true;
+    if (p_args->event == ADC_EVENT_WINDOW_COMPARE_A) {
+        g_adc_window_hit = true; // 구간 판단은 스캔 완료에서 (변환 결과가 필요)
+    }
+    else if (p_args->event == ADC_EVENT_SCAN_COMPLETE) {
+        uint16_t data;
+        if (R_ADC_Read(&g_adc0_ctrl, ADC_CHANNEL_0, &data) != FSP_SUCCESS) return;
+        adc_window_check(data);
+
+        // 소프트웨어 트리거: 결과만 저장 (adc_read() 에서 사용)
+        if (!g_adc_hw_trigger) {
+            g_adc_sample = data;
+            g_scan_complete = true;
+            return;
+        }
+
+        // 하드웨어 트리거: 변환 결과를 채우는 블록에 저장, 블록이 차면 메인 루프로 넘김
+        if (adc_block_write(&g_adc_blocks, data)) event_post(EVENT_ADC);
     }
 }
 
 
-// ■ ADC 초기화
-void adc_init(){
-    // ADC OPEN
-    err = R_ADC_Open(&g_adc0_ctrl, &g_adc0_cfg);
-    //    if(err == FSP_SUCCESS) uart_write("\033[34mADC OPEN 성공", NO_VAR);
-    //    else uart_write("ADC OPEN 성공", err);
+// ■ 밝기 구간 판단 (data: ADC 원래 값, 오버샘플링 scale 포함)
+static inline light_zone_t adc_light_zone(uint32_t data, uint32_t scale) {
+    if (data <= g_light_threshold_low * scale) return LIGHT_ZONE_DARK;
+    if (data >= g_light_threshold_high * scale) return LIGHT_ZONE_BRIGHT;
+    return LIGHT_ZONE_MID;
+}
 
-    // ADC Scan Config
-    err = R_ADC_ScanCfg(&g_adc0_ctrl, &g_adc0_channel_cfg);
-    //    if(err == FSP_SUCCESS) uart_write("ADC SCAN 설정 성공했습니다.", NO_VAR);
-    //    else uart_write("\033[37;41mADC SCAN 설정 실패했습니다.", err); // \033[37;41m: 빨간배경 흰색 글씨
 
+// ■ 윈도우 비교 조건 설정: 현재 구간에서 벗어나는 조건을 기다림 (스캔 사이에 호출)
+void adc_window_arm(light_zone_t zone) {
+    uint32_t scale = g_adc_oversample_modes[g_adc_oversample].scale;
+    uint32_t hysteresis = ADC_WINDOW_HYSTERESIS * scale;
+    R_ADC0_Type *reg = R_ADC0;
+
+    switch (zone) {
+        case LIGHT_ZONE_DARK:   // 값 > LOW + 히스테리시스
+            reg->ADCMPCR = (uint16_t)(reg->ADCMPCR & ~R_ADC0_ADCMPCR_WCMPE_Msk);
+            reg->ADCMPDR0 = (uint16_t)(g_light_threshold_low * scale + hysteresis);
+            reg->ADCMPLR[0] = (uint16_t)(reg->ADCMPLR[0] | 1U);
+            break;
+        case LIGHT_ZONE_BRIGHT: // 값 < HIGH - 히스테리시스
+            reg->ADCMPCR = (uint16_t)(reg->ADCMPCR & ~R_ADC0_ADCMPCR_WCMPE_Msk);
+            reg->ADCMPDR0 = (uint16_t)(g_light_threshold_high * scale - hysteresis);
+            reg->ADCMPLR[0] = (uint16_t)(reg->ADCMPLR[0] & ~1U);
+            break;
+        case LIGHT_ZONE_MID:    // 값 < LOW 또는 값 > HIGH (윈도우 밖)
+        default:
+            reg->ADCMPCR = (uint16_t)(reg->ADCMPCR | R_ADC0_ADCMPCR_WCMPE_Msk);
+            reg->ADCMPDR0 = (uint16_t)(g_light_threshold_low * scale);
+            reg->ADCMPDR1 = (uint16_t)(g_light_threshold_high * scale);
+            reg->ADCMPLR[0] = (uint16_t)(reg->ADCMPLR[0] & ~1U);
+            break;
+    }
+    reg->ADCMPSR[0] = (uint16_t)~1U; // 채널 0 비교 결과 플래그 지우기 (0 쓰기)
 }
 
 
+// ■ 윈도우 비교 결과 확인 (adc_callback, 스캔 완료마다): 조건이 맞은 경우에만 구간 변경
+void adc_window_check(uint16_t data) {
+    if (!g_adc_window_hit && (R_ADC0->ADCMPSR[0] & 1U) == 0) return;
+    g_adc_window_hit = false;
 
-void ring_buf_init(ring_buf_t *rb) {
-    memset(rb->buffer, 0, sizeof(rb->buffer));
-    rb->head = 0;
-    rb->tail = 0;
-    rb->count = 0;
-    rb->sum = 0;
+    light_zone_t zone = adc_light_zone(data, g_adc_oversample_modes[g_adc_oversample].scale);
+    if (zone != g_light_zone) {
+        g_light_zone = zone;
+        event_post(EVENT_LIGHT);
+    }
+    adc_window_arm(zone);
 }
 
-void ring_buf_push(ring_buf_t *rb, uint16_t data) {
-    // 새 데이터를 버퍼에 추가하고 합계 업데이트
-    if(data != 0){
-        // 기존 위치의 데이터를 합계에서 제거
-        if (rb->count == ADC_BUFFER_SIZE) {
-            rb->sum -= rb->buffer[rb->head];
-            rb->head = (rb->head + 1) % ADC_BUFFER_SIZE;
-        }
 
-        rb->buffer[rb->tail] = data;
-            rb->sum += data;
-            rb->tail = (rb->tail + 1) % ADC_BUFFER_SIZE;
+// ■ 자동 조명 기준값 변경 (12비트 기준, 실패하면 false)
+_Bool adc_window_set_thresholds(uint32_t low, uint32_t high) {
+    if (high > ADC_MAX_VALUE || low + 2 * ADC_WINDOW_HYSTERESIS >= high) return false;
 
-            // 버퍼 카운트 조정
-            if (rb->count < ADC_BUFFER_SIZE) {
-                rb->count++;
-            }
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    g_light_threshold_low = (uint16_t)low;
+    g_light_threshold_high = (uint16_t)high;
+    adc_window_arm(g_light_zone); // 현재 구간이 새 기준과 다르면 다음 변환에서 바로 이벤트
+    FSP_CRITICAL_SECTION_EXIT;
+    return true;
+}
+
+
+// ■ ADC 블록 처리 (반환값: 12비트 기준 필터 출력)
+uint16_t adc_block_process(const uint16_t *block) {
+#if LIGHT_FILTER_ENABLE
+    return light_filter_process(&g_light_filter, block, g_adc_oversample_modes[g_adc_oversample].scale_log2);
+#else
+    uint32_t sum = 0;
+    for (uint16_t i = 0; i < ADC_BLOCK_SIZE; i++) {
+        sum += block[i];
+    }
+    uint32_t n = (uint32_t)ADC_BLOCK_SIZE * g_adc_oversample_modes[g_adc_oversample].scale;
+    return (uint16_t)((sum + n / 2) / n);
+#endif
+}
+
+
+// ■ 필터 출력으로 밝기 구간 확인 (히스테리시스 포함), 바뀌었으면 자동 조명 적용
+void light_update(uint16_t filtered) {
+    light_zone_t zone = adc_light_zone(filtered, 1);
+    light_zone_t applied = g_light_applied_zone;
+
+    // 적용된 구간에서 벗어날 때는 히스테리시스만큼 더 넘어가야 함
+    if (applied == LIGHT_ZONE_DARK && filtered <= g_light_threshold_low + ADC_WINDOW_HYSTERESIS) zone = applied;
+    if (applied == LIGHT_ZONE_BRIGHT && filtered + ADC_WINDOW_HYSTERESIS >= g_light_threshold_high) zone = applied;
+
+    if (zone != applied || g_light_force) {
+        g_light_applied_zone = zone;
+        g_light_force = false;
+        auto_on_off(zone);
+    }
+}
+
+
+// ■ ADC 샘플링 타이머 (GPT1 오버플로우 > ELC > ADC0 스캔 시작)
+fsp_err_t adc_sample_timer_init() {
+    fsp_err_t status = R_GPT_Open(&g_adc_timer_ctrl, &g_adc_timer_cfg);
+    if (status != FSP_SUCCESS) return status;
+
+    // 주기 = 타이머 클럭 / 샘플링 주파수
+    timer_info_t info;
+    R_GPT_InfoGet(&g_adc_timer_ctrl, &info);
+    status = R_GPT_PeriodSet(&g_adc_timer_ctrl, info.clock_frequency / ADC_SAMPLE_RATE_HZ);
+    if (status != FSP_SUCCESS) return status;
+
+    // ELC: GPT1 오버플로우 이벤트를 ADC0 (ELC_AD0) 시작 트리거로 연결 (r_elc 드라이버 없이 레지스터 직접 설정)
+    R_BSP_MODULE_START(FSP_IP_ELC, 0);
+    R_ELC->ELSR[ELC_PERIPHERAL_ADC0].HA = (uint16_t) ELC_EVENT_GPT1_COUNTER_OVERFLOW;
+    R_ELC->ELCR = R_ELC_ELCR_ELCON_Msk;
+
+    return R_GPT_Start(&g_adc_timer_ctrl);
+}
+
+
+// ■ ADC OPEN + SCAN 설정 (현재 오버샘플링 설정 적용)
+fsp_err_t adc_open() {
+    const adc_oversample_t *os = &g_adc_oversample_modes[g_adc_oversample];
+    g_adc_run_cfg_extend.add_average_count = os->add;
+    g_adc_run_channel_cfg.add_mask = (os->add == ADC_ADD_OFF) ? 0U : (uint32_t)ADC_MASK_CHANNEL_0;
+    g_adc_window_cfg.compare_ref_low = (uint16_t)(g_light_threshold_low * os->scale);
+    g_adc_window_cfg.compare_ref_high = (uint16_t)(g_light_threshold_high * os->scale);
+
+    // ADC OPEN
+    fsp_err_t status = R_ADC_Open(&g_adc0_ctrl, &g_adc_run_cfg);
+    //    if(status == FSP_SUCCESS) uart_write("\033[34mADC OPEN 성공", NO_VAR);
+    //    else uart_write("ADC OPEN 성공", status);
+    if (status != FSP_SUCCESS) return status;
+
+    // ADC Scan Config (윈도우 비교 포함) > 현재 구간의 비교 조건으로 설정
+    status = R_ADC_ScanCfg(&g_adc0_ctrl, &g_adc_run_channel_cfg);
+    if (status == FSP_SUCCESS) adc_window_arm(g_light_zone);
+    return status;
+}
+
+
+// ■ ADC 초기화
+void adc_init(){
+    // 생성된 설정 복사 (하드웨어 트리거일 때만 트리거를 ELC 로 변경)
+    g_adc_run_cfg_extend = *(adc_extended_cfg_t const *) g_adc0_cfg.p_extend;
+    g_adc_run_cfg = g_adc0_cfg;
+    g_adc_run_cfg.p_extend = &g_adc_run_cfg_extend;
+    g_adc_run_channel_cfg = g_adc0_channel_cfg;
+    g_adc_run_channel_cfg.p_window_cfg = &g_adc_window_cfg;
+    light_filter_init(&g_light_filter);
+#if ADC_HW_TRIGGER
+    g_adc_run_cfg_extend.trigger = ADC_START_SOURCE_ELC_AD0;
+#endif
+
+    err = adc_open();
+    //    if(err == FSP_SUCCESS) uart_write("ADC SCAN 설정 성공했습니다.", NO_VAR);
+    //    else uart_write("\033[37;41mADC SCAN 설정 실패했습니다.", err); // \033[37;41m: 빨간배경 흰색 글씨
+
+#if ADC_HW_TRIGGER
+    // 하드웨어 트리거 허용 (ScanStart 는 이때 한 번만 호출) > 샘플링 타이머 시작
+    g_adc_hw_trigger = true;
+    if (err == FSP_SUCCESS) err = R_ADC_ScanStart(&g_adc0_ctrl);
+    if (err == FSP_SUCCESS) err = adc_sample_timer_init();
+    if (err != FSP_SUCCESS) {
+        // 타이머/트리거 실패 > 소프트웨어 트리거로 다시 열기
+        uart_write("\033[37;41mADC 하드웨어 트리거 실패 (소프트웨어 모드)", err);
+        g_adc_hw_trigger = false;
+        R_ADC_Close(&g_adc0_ctrl);
+        g_adc_run_cfg_extend.trigger = ADC_START_SOURCE_DISABLED;
+        err = adc_open();
+    }
+#endif
+
+    // 소프트웨어 트리거: 첫 스캔 시작 (결과는 다음 adc_read() 에서 읽음)
+    if (!g_adc_hw_trigger) {
+        err = R_ADC_ScanStart(&g_adc0_ctrl);
     }
 }
 
-uint16_t ring_buf_avg(ring_buf_t *rb) {
-    // 평균을 계산하여 반환
-    return rb->count > 0 ? rb->sum / rb->count : 0;
+
+// ■ ADC 오버샘플링 변경 (ADC 를 다시 열어서 적용, 이전 설정으로 채우던 블록은 버림)
+fsp_err_t adc_set_oversample(uint8_t mode) {
+    if (mode >= ADC_OVERSAMPLE_MODE_COUNT) return FSP_ERR_INVALID_ARGUMENT;
+
+    if (g_adc_hw_trigger) R_GPT_Stop(&g_adc_timer_ctrl);
+    R_ADC_Close(&g_adc0_ctrl); // ADC 인터럽트도 꺼짐 > 블록 초기화 가능
+
+    g_adc_oversample = mode;
+    adc_block_reset(&g_adc_blocks);
+    g_scan_complete = false;
+
+    fsp_err_t status = adc_open();
+    if (status == FSP_SUCCESS) status = R_ADC_ScanStart(&g_adc0_ctrl);
+    if (g_adc_hw_trigger) R_GPT_Start(&g_adc_timer_ctrl);
+    return status;
 }
 
 
+
 // ■ ADC 조도센서 읽어오기 (반환값: adc 평균 데이터)
 int adc_read(){
+    // [참고] adc_data  -> 전압 으로 바꾸고 싶으면, 4095.0으로 나누고 5 곱하기
+    if (g_adc_hw_trigger) {
+        // 하드웨어 트리거: 완성된 블록을 순서대로 처리 (블록 평균을 링버퍼에 추가)
+        const uint16_t *block;
+        while ((block = adc_block_peek(&g_adc_blocks)) != NULL) {
+            g_adc_data = adc_block_process(block);
+            adc_block_release(&g_adc_blocks);
+            adc_avg_buf_push(&g_adc_buffer, g_adc_data);
+        }
+        return adc_avg_buf_mean(&g_adc_buffer);
+    }
+
+    // 소프트웨어 트리거: 스캔이 끝난 경우에만 읽고, 다음 스캔 시작
+    if (!g_scan_complete) {
+        return adc_avg_buf_mean(&g_adc_buffer);
+    }
+    g_scan_complete = false;
+
+    // ADC READ (콜백에서 읽어둔 값)
+    g_adc_data = (uint16_t)(g_adc_sample / g_adc_oversample_modes[g_adc_oversample].scale); // 12비트 기준
+//    uart_write("ADC 데이터", (uint16_t)g_adc_data); // 흰색: \033[0m
+    adc_avg_buf_push(&g_adc_buffer, g_adc_data);
+
     // ADC SCAN
     err = R_ADC_ScanStart(&g_adc0_ctrl);
     //    if(err == FSP_SUCCESS) uart_write("ADC SCAN START 성공했습니다.", NO_VAR);
     //    else uart_write("\033[37;41mADC SCAN START실패했습니다.", err);
 
-
-    // ADC READ
-    // [참고] adc_data  -> 전압 으로 바꾸고 싶으면, 4095.0으로 나누고 5 곱하기
-    err = R_ADC_Read(&g_adc0_ctrl, ADC_CHANNEL_0, &g_adc_data);
-    if(err == FSP_SUCCESS) {
-//        uart_write("ADC READ 성공했습니다.", NO_VAR);
-//        uart_write("ADC 데이터", (uint16_t)g_adc_data); // 흰색: \033[0m
-
-        ring_buf_push(&g_adc_buffer, g_adc_data);
-        uint16_t average = ring_buf_avg(&g_adc_buffer);
-        return average;
-    }
-    else {
-        uart_write("\033[37;41mADC READ 실패했습니다", err);
-        return 0;
-    }
-
+    return adc_avg_buf_mean(&g_adc_buffer);
 }
 
 // ■ GPT OPEN
@@ -328,19 +908,6 @@ void set_period(timer_ctrl_t * const p_ctrl, uint32_t const period_counts) {
 }
 
 
-// ■ GPT Duty Cycle 변경
-void set_duty_cycle(timer_ctrl_t * const p_ctrl, uint32_t const duty_cycle) {
-    err = R_GPT_DutyCycleSet(p_ctrl, duty_cycle, GPT_IO_PIN_GTIOCA);
-    //    if (err == FSP_SUCCESS) uart_write("\033[35mDuty Cycle 설정에 성공했습니다", (uint16_t)duty_cycle); // \033[35m : 보라색
-    //    else uart_write("\033[37;41mDuty Cycle 설정에 실패했습니다", err);
-
-    if (p_ctrl == &g_timer3_ctrl) g_R_LED_duty_cycle = duty_cycle;
-    else if (p_ctrl == &g_timer4_ctrl) g_G_LED_duty_cycle = duty_cycle;
-    else if (p_ctrl == &g_timer6_ctrl) g_B_LED_duty_cycle = duty_cycle;
-}
-
-
-
 // ■ GPT START
 void start_gpt(timer_ctrl_t * const p_ctrl) {
     err = R_GPT_Start(p_ctrl);
@@ -351,31 +918,188 @@ void start_gpt(timer_ctrl_t * const p_ctrl) {
 
 // ■ PWM 초기화
 void pwm_init(){
+    // (0) G/B 타이머 설정을 R 타이머(GPT3)에 맞춤
+    //     FSP 설정은 GPT4/6 만 PCLKD/256 > 주기 끝이 달라서 세 채널을 같은 주기에 바꿀 수 없음
+    //     G/B 는 오버플로우 인터럽트 없음, GPT3 는 디더링 ON 일 때만 (시간은 SysTick 으로)
+    g_timer4_run_cfg = g_timer4_cfg;
+    g_timer4_run_cfg.source_div = g_timer3_cfg.source_div;
+    g_timer4_run_cfg.p_callback = NULL;
+    g_timer4_run_cfg.cycle_end_irq = FSP_INVALID_VECTOR;
+    g_timer6_run_cfg = g_timer6_cfg;
+    g_timer6_run_cfg.source_div = g_timer3_cfg.source_div;
+    g_timer6_run_cfg.p_callback = NULL;
+    g_timer6_run_cfg.cycle_end_irq = FSP_INVALID_VECTOR;
+
     // (1) GPT OPEN : 3, 4, 6
     gpt_open(&g_timer3_ctrl, &g_timer3_cfg);
-    gpt_open(&g_timer4_ctrl, &g_timer4_cfg);
-    gpt_open(&g_timer6_ctrl, &g_timer6_cfg);
+    gpt_open(&g_timer4_ctrl, &g_timer4_run_cfg);
+    gpt_open(&g_timer6_ctrl, &g_timer6_run_cfg);
+    rgb_sync_init(&g_rgb_sync, g_timer3_ctrl.p_reg, g_timer4_ctrl.p_reg, g_timer6_ctrl.p_reg,
+                  RGB_PWM_PERIOD, RGB_SYNC_WRITE_LIMIT, RGB_SYNC_GUARD);
 
     // (2) SET Period
     set_period(&g_timer3_ctrl, RGB_PWM_PERIOD);
     set_period(&g_timer4_ctrl, RGB_PWM_PERIOD);
     set_period(&g_timer6_ctrl, RGB_PWM_PERIOD);
 
-    // (3) SET Duty Cycle
-    set_duty_cycle(&g_timer3_ctrl, RGB_PWM_PERIOD);
-    set_duty_cycle(&g_timer4_ctrl, RGB_PWM_PERIOD);
-    set_duty_cycle(&g_timer6_ctrl, RGB_PWM_PERIOD);
+    // (3) SET Duty Cycle (타이머 시작 전이라 바로 적용)
+    rgb_fade_to(RGB_PWM_PERIOD, RGB_PWM_PERIOD, RGB_PWM_PERIOD, 0);
 
-    // (4) GPT Start
-    start_gpt(&g_timer3_ctrl);
-    start_gpt(&g_timer4_ctrl);
-    start_gpt(&g_timer6_ctrl);
+    // (4) GPT Start (세 채널 동시에)
+    pwm_sync_start();
 
-    // GPT Callback 등록
+    // GPT Callback 등록 (디더링 전용, 켜기 전까지 인터럽트 금지)
     R_GPT_CallbackSet(&g_timer3_ctrl, g_timer_callback , NULL, NULL);
-    R_GPT_CallbackSet(&g_timer4_ctrl, g_timer_callback , NULL, NULL);
-    R_GPT_CallbackSet(&g_timer6_ctrl, g_timer_callback , NULL, NULL);
+    R_BSP_IrqDisable(g_timer3_cfg.cycle_end_irq);
+
+}
+
+// ■ R/G/B 타이머 동시 정지 > 카운터 클리어 > 동시 시작
+//   GTSTP/GTCLR/GTSTR 은 모든 채널 공용 레지스터 (비트 = 채널), 한 번 쓰면 세 채널이 같은 클럭에 동작
+void pwm_sync_start() {
+    R_GPT0_Type * const p_reg = g_timer3_ctrl.p_reg;
+    uint32_t mask = RGB_PWM_CHANNEL_MASK;
+
+    p_reg->GTSTP = mask;
+    p_reg->GTCLR = mask;
+    p_reg->GTSTR = mask;
+}
+
+/***
+ RGB 듀티 동시 변경
+ 채널마다 따로 쓰면 (R_GPT_DutyCycleSet() 세 번) 각 값이 버퍼(GTCCRC) 에 들어간 순서대로 주기 끝에 반영
+ > 쓰는 도중에 주기 끝이 지나가면 한 주기 동안 섞인 색(예: R 만 바뀐 색)이 보임
+ 레지스터 순서 (BD0 로 전송 금지 > 주기 앞부분에서 세 채널 쓰기 > 전송 허용) 는 rgb_sync_write() (rgb_sync.h)
+ 인터럽트 금지 구간은 최대 한 주기 반 정도 (RGB_PWM_PERIOD 카운트 1.5 번)
+ ***/
+// ■ R/G/B 듀티를 같은 주기에 한 번에 변경 (PWM 출력만, 목표 듀티는 rgb_fade_to() 에서)
+void set_rgb(uint32_t r_duty, uint32_t g_duty, uint32_t b_duty) {
+    const uint32_t duty[3] = { r_duty, g_duty, b_duty };
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    FSP_CRITICAL_SECTION_ENTER;
+    rgb_sync_write(&g_rgb_sync, duty);
+    memcpy(g_rgb_output, duty, sizeof(g_rgb_output));
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+// ■ 이징 곡선 (p, 반환값 모두 Q16: 0 ~ RGB_FADE_Q16_ONE)
+static inline uint32_t fade_ease(fade_ease_t ease, uint32_t p) {
+    uint64_t p2 = ((uint64_t)p * p) >> 16;
+    uint32_t q = RGB_FADE_Q16_ONE - p;
+    switch (ease) {
+        case FADE_EASE_IN:
+            return (uint32_t)p2;
+        case FADE_EASE_OUT:
+            return RGB_FADE_Q16_ONE - (uint32_t)(((uint64_t)q * q) >> 16);
+        case FADE_EASE_IN_OUT:
+            return (uint32_t)((p2 * (3U * RGB_FADE_Q16_ONE - 2U * p)) >> 16);
+        case FADE_EASE_LINEAR:
+        default:
+            return p;
+    }
+}
 
+// ■ 페이드 시작 (카운트 단위): 지금 출력 중인 색 > (r, g, b) 를 duration_ms 동안 (0 이면 바로 변경)
+void rgb_fade_to(uint32_t r_duty, uint32_t g_duty, uint32_t b_duty, uint32_t duration_ms) {
+    const uint32_t to[3] = { RGB_FINE(r_duty), RGB_FINE(g_duty), RGB_FINE(b_duty) };
+    rgb_fade_to_fine(to, duration_ms);
+}
+
+// ■ 페이드 시작 (fine 단위)
+//   LED 색을 바꾸는 곳은 모두 여기를 거침 (페이드 중에 set_rgb() 를 따로 부르면 다음 단계에서 덮어써짐)
+void rgb_fade_to_fine(const uint32_t to[3], uint32_t duration_ms) {
+    uint32_t steps = duration_ms * RGB_FADE_STEP_HZ / 1000U;
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    FSP_CRITICAL_SECTION_ENTER;
+    g_R_LED_duty_cycle = RGB_FINE_CEIL(to[0]); // 아주 어두운 디더링 값도 "켜짐" 으로
+    g_G_LED_duty_cycle = RGB_FINE_CEIL(to[1]);
+    g_B_LED_duty_cycle = RGB_FINE_CEIL(to[2]);
+
+    // 같은 목표로 페이드 중이면 그대로 둠 (자동 조명이 같은 색을 다시 요청해도 처음부터 다시 시작하지 않음)
+    if (g_rgb_fade.active && steps > 0 && memcmp(g_rgb_fade.to, to, sizeof(g_rgb_fade.to)) == 0) {
+        FSP_CRITICAL_SECTION_EXIT;
+        return;
+    }
+
+    memcpy(g_rgb_fade.from, g_rgb_fine, sizeof(g_rgb_fade.from));
+    memcpy(g_rgb_fade.to, to, sizeof(g_rgb_fade.to));
+    g_rgb_fade.steps = steps;
+    g_rgb_fade.step = 0;
+    g_rgb_fade.ease = g_fade_ease;
+    g_rgb_fade.active = (steps > 0);
+    if (steps == 0) {
+        tw_cancel(&g_fade_timer);
+        rgb_output_fine(to);
+    }
+    else tw_start(&g_timer_wheel, &g_fade_timer, RGB_FADE_TICKS_PER_STEP, RGB_FADE_TICKS_PER_STEP);
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+// ■ 페이드 한 단계 (타이머 휠에서 RGB_FADE_STEP_HZ 마다 호출)
+void rgb_fade_step() {
+    if (!g_rgb_fade.active) return;
+
+    uint32_t step = ++g_rgb_fade.step;
+    uint32_t eased = fade_ease(g_rgb_fade.ease, (uint32_t)(((uint64_t)step << 16) / g_rgb_fade.steps));
+    uint32_t duty[3];
+    for (uint8_t ch = 0; ch < 3; ch++) {
+        int32_t delta = (int32_t)g_rgb_fade.to[ch] - (int32_t)g_rgb_fade.from[ch];
+        duty[ch] = (uint32_t)((int32_t)g_rgb_fade.from[ch] + (int32_t)(((int64_t)delta * eased) / RGB_FADE_Q16_ONE));
+    }
+
+    rgb_output_fine(duty);
+    if (step >= g_rgb_fade.steps) {
+        g_rgb_fade.active = false;
+        tw_cancel(&g_fade_timer); // 다음 페이드까지 틱 없음
+    }
+}
+
+// ■ 출력 듀티 변경 (fine): 디더링 중이면 다음 PWM 주기부터 GPT3 콜백이 반영, 아니면 반올림해서 바로 출력
+//   디더링 중이라도 세 채널 모두 정수 카운트면 인터럽트를 끄고 바로 출력
+void rgb_output_fine(const uint32_t fine[3]) {
+    memcpy(g_rgb_fine, fine, sizeof(g_rgb_fine));
+    if (g_rgb_dither) {
+        _Bool fraction = ((fine[0] | fine[1] | fine[2]) & RGB_DITHER_MASK) != 0;
+        rgb_dither_irq(fraction);
+        if (fraction) return;
+    }
+
+    uint32_t r = RGB_FINE_ROUND(fine[0]), g = RGB_FINE_ROUND(fine[1]), b = RGB_FINE_ROUND(fine[2]);
+    // 바뀐 채널이 있을 때만 PWM 갱신 (느린 페이드는 여러 단계 동안 같은 값)
+    if (r != g_rgb_output[0] || g != g_rgb_output[1] || b != g_rgb_output[2]) set_rgb(r, g, b);
+}
+
+// ■ 디더링 인터럽트 (GPT3 주기 끝, 100kHz) 켜기/끄기, 이미 같은 상태면 아무것도 안 함
+void rgb_dither_irq(_Bool on) {
+    if (on == g_rgb_dither_irq) return;
+    g_rgb_dither_irq = on;
+    if (on) R_BSP_IrqEnable(g_timer3_cfg.cycle_end_irq); // 밀려 있던 요청은 지우고 켬
+    else R_BSP_IrqDisable(g_timer3_cfg.cycle_end_irq);
+}
+
+// ■ 디더링 ON/OFF
+void rgb_dither_enable(_Bool on) {
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    FSP_CRITICAL_SECTION_ENTER;
+    memset(g_rgb_dither_acc, 0, sizeof(g_rgb_dither_acc));
+    g_rgb_dither = on;
+    if (!on) rgb_dither_irq(false);
+    rgb_output_fine(g_rgb_fine); // ON: 소수 부분이 있을 때만 인터럽트, OFF/정수: 반올림해서 바로 출력
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+// ■ 디더링 한 주기 (GPT3 오버플로우마다, 주기 시작 직후라 세 채널 모두 다음 주기 끝에 함께 반영)
+void rgb_dither_step() {
+    for (uint8_t ch = 0; ch < 3; ch++) {
+        uint32_t counts = rgb_dither_next(&g_rgb_dither_acc[ch], g_rgb_fine[ch]);
+        if (counts != g_rgb_output[ch]) {
+            rgb_sync_compare(&g_rgb_sync, ch, counts);
+            g_rgb_output[ch] = counts;
+        }
+    }
 }
 
 // ■ RGB_LED 점등 여부
@@ -386,35 +1110,18 @@ _Bool is_RGB_LED_ON(){
 
 // ■ RGB_LED 끄기 (모든 LED OFF)
 void RGB_LED_OFF(){
-    g_R_LED_duty_cycle = 0;
-    g_G_LED_duty_cycle = 0;
-    g_B_LED_duty_cycle = 0;
-
-    set_duty_cycle(&g_timer3_ctrl, g_R_LED_duty_cycle);
-    set_duty_cycle(&g_timer4_ctrl, g_G_LED_duty_cycle);
-    set_duty_cycle(&g_timer6_ctrl, g_B_LED_duty_cycle);
+    rgb_fade_to(0, 0, 0, RGB_FADE_DEFAULT_MS);
 }
 
 // ■ RGB_LED 켜기 (모든 LED ON)
 void RGB_LED_ON(){
-    g_R_LED_duty_cycle = RGB_PWM_PERIOD;
-    g_G_LED_duty_cycle = RGB_PWM_PERIOD;
-    g_B_LED_duty_cycle = RGB_PWM_PERIOD;
-
-    set_duty_cycle(&g_timer3_ctrl, g_R_LED_duty_cycle);
-    set_duty_cycle(&g_timer4_ctrl, g_G_LED_duty_cycle);
-    set_duty_cycle(&g_timer6_ctrl, g_B_LED_duty_cycle);
+    rgb_fade_to(RGB_PWM_PERIOD, RGB_PWM_PERIOD, RGB_PWM_PERIOD, RGB_FADE_DEFAULT_MS);
 }
 
 // ■ RGB_LED 반만 켜기 (약간 어둡게)
 void RGB_HALF_ON(){
-    g_R_LED_duty_cycle = gamma_correct_duty_cycle(RGB_PWM_PERIOD/2);
-    g_G_LED_duty_cycle = gamma_correct_duty_cycle(RGB_PWM_PERIOD/2);
-    g_B_LED_duty_cycle = gamma_correct_duty_cycle(RGB_PWM_PERIOD/2);
-
-    set_duty_cycle(&g_timer3_ctrl, g_R_LED_duty_cycle);
-    set_duty_cycle(&g_timer4_ctrl, g_G_LED_duty_cycle);
-    set_duty_cycle(&g_timer6_ctrl, g_B_LED_duty_cycle);
+    uint32_t half = gamma_correct_duty_cycle(RGB_PWM_PERIOD/2);
+    rgb_fade_to(half, half, half, RGB_FADE_DEFAULT_MS);
 }
 
 
@@ -426,53 +1133,42 @@ void Device_Init() {
     // ADC ( Analog to Digital )
     adc_init();
 
+    // 시스템 틱 (SysTick) + 타이머 휠 (pwm_init 의 첫 페이드보다 먼저)
+    system_tick_init();
+
     // PWM ( Pulse Width Modulation )
     pwm_init();
 
     // ring buffer init
-    ring_buf_init(&g_adc_buffer);
+    adc_avg_buf_init(&g_adc_buffer);
 }
 
 
-// ■ 밝기에 따라 자동 RGB LED 점등
-void auto_on_off(int adc_avg){
+// ■ 밝기 구간에 따라 자동 RGB LED 점등 (ADC 윈도우 비교로 구간이 바뀐 경우에만 호출)
+void auto_on_off(light_zone_t zone){
     if(g_manual_control) return; // 수동제어 활성화 동안, 자동제어 비활성화
-    switch(is_RGB_LED_ON()){
-        if(g_manual_control) return;
-        // LED가 켜져있을 때
-        case true:
-            // 주변이 밝으면,
-            if(adc_avg >= ADC_THRESHOLD_HIGH) {
-//                uart_write("\033[31mLED를 꺼야 해요", (uint16_t)adc_avg); // \033[31m : 빨강
+    switch(zone){
+        // 주변이 밝으면,
+        case LIGHT_ZONE_BRIGHT:
+            if(is_RGB_LED_ON()) {
+//                uart_write("\033[31mLED를 꺼야 해요", NO_VAR); // \033[31m : 빨강
                 RGB_LED_OFF();
             }
-            // 주변이 어두우면,
-            else if(adc_avg <= ADC_THRESHOLD_LOW){
-                // 유지
-            }
-            // 밝음과 어두움 중간,
-            else {
-//                uart_write("\033[31mLED를 조금 어둡게 켜야 해요.", (uint16_t)adc_avg); // \033[31m : 빨강
-                RGB_HALF_ON();
-            }
             break;
 
-            // LED가 꺼져있을 때
-        case false:
-            // 주변이 어두우면,
-            if(adc_avg <= ADC_THRESHOLD_LOW){
-//                uart_write("\033[31mLED를 켜야 해요", (uint16_t)adc_avg);
+        // 주변이 어두우면,
+        case LIGHT_ZONE_DARK:
+            if(!is_RGB_LED_ON()) {
+//                uart_write("\033[31mLED를 켜야 해요", NO_VAR);
                 RGB_LED_ON();
             }
-            // 주변이 밝으면,
-            else if(adc_avg >= ADC_THRESHOLD_HIGH){
-                // 유지
-            }
-            // 밝음과 어두움 중간,
-            else {
-                uart_write("\033[31mLED를 조금 어둡게 켜야 해요.", (uint16_t)adc_avg); // \033[31m : 빨강
-                RGB_HALF_ON();
-            }
+            break;
+
+        // 밝음과 어두움 중간,
+        case LIGHT_ZONE_MID:
+        default:
+//            uart_write("\033[31mLED를 조금 어둡게 켜야 해요.", NO_VAR); // \033[31m : 빨강
+            RGB_HALF_ON();
             break;
     }
 }
@@ -488,18 +1184,41 @@ void auto_on_off(int adc_avg){
  이런 "비선형성을 보정"하기 위해, "감마 보정"을 사용
  감마보정: 듀티사이클에 비선형 함수를 적용하여, 밝기가 선형적으로 느껴지도록 보정
          공식 : L_out = L_in ^ γ(gamma), L_in은 [0,1]로 정규화된 데이터
+ 계산은 빌드 전에 tools/gamma_table.py 로 미리 해 둠 (pow() 대신 테이블 한 번 읽기)
  ***/
-// ■ 감마 보정
+// ■ 감마 보정 (주기보다 큰 값은 주기로 제한)
 uint32_t gamma_correct_duty_cycle(uint32_t duty_cycle) {
-    // 듀티 사이클을 [0, 1] 범위로 정규화
-    double normalized_duty_cycle = (double)duty_cycle / RGB_PWM_PERIOD;
+    if (duty_cycle > RGB_PWM_PERIOD) duty_cycle = RGB_PWM_PERIOD;
+    return g_gamma_table[duty_cycle];
+}
 
-    // 감마 보정
-    double corrected_intensity = pow(normalized_duty_cycle, 1/GAMMA);
+// ■ 감마 보정 (fine 단위): 테이블 두 칸 사이를 선형 보간 > 어두운 구간(0 > 43 카운트 등) 도 촘촘하게
+uint32_t gamma_correct_fine(uint32_t fine) {
+    uint32_t index = fine >> RGB_DITHER_BITS;
+    if (index >= RGB_PWM_PERIOD) return RGB_FINE(g_gamma_table[RGB_PWM_PERIOD]);
+    uint32_t frac = fine & RGB_DITHER_MASK;
+    return RGB_FINE(g_gamma_table[index]) + (uint32_t)(g_gamma_table[index + 1] - g_gamma_table[index]) * frac;
+}
 
-    // 보정된 듀티 사이클을 다시 0-255 범위로 조정
-    uint32_t corrected_duty_cycle = (uint32_t)(corrected_intensity * RGB_PWM_PERIOD);
-    return corrected_duty_cycle;
+// ■ 색 > R/G/B 듀티 (fine 단위, 감마 보정, 화이트 밸런스 포함)
+void color_to_duty_cycles(const color_state_t *color, uint32_t duty[3]) {
+    color_rgb_t rgb;
+    if (color->mode == COLOR_MODE_CCT) color_cct_to_rgb(color->kelvin, color->val, &rgb);
+    else color_hsv_to_rgb(color->hue, color->sat, color->val, &rgb);
+
+    const uint16_t level[3] = { rgb.r, rgb.g, rgb.b };
+    for (uint8_t ch = 0; ch < 3; ch++) {
+        uint32_t linear = (RGB_FINE((uint32_t)level[ch] * RGB_PWM_PERIOD) + COLOR_ONE / 2) / COLOR_ONE;
+        duty[ch] = gamma_correct_fine(linear) * g_white_balance[ch] / 100U;
+    }
+}
+
+// ■ 현재 색(g_color) 을 LED 트랜잭션에 저장 (프레임이 끝나면 한 번에, F 로 지정한 시간 동안 페이드)
+void color_stage() {
+    uint32_t duty[3];
+    g_manual_control = true;  // 수동 제어 활성화
+    color_to_duty_cycles(&g_color, duty);
+    for (uint8_t ch = 0; ch < 3; ch++) led_txn_stage(ch, duty[ch]);
 }
 
 // ■ RGB_LED Duty Cycle 변경을 통한, 밝기 조절
@@ -511,8 +1230,7 @@ void set_duty_cycles_by_ratio(int n) {
     if(g_R_LED_duty_cycle == 0 && g_G_LED_duty_cycle == 0 && g_B_LED_duty_cycle == 0){
         // 아직 생각 중
         uart_write("No duty cycle set", NO_VAR);
-        set_duty_cycle(&g_timer3_ctrl, RGB_PWM_PERIOD);
-        set_duty_cycle(&g_timer6_ctrl, RGB_PWM_PERIOD);
+        rgb_fade_to(RGB_PWM_PERIOD, g_G_LED_duty_cycle, RGB_PWM_PERIOD, RGB_FADE_DEFAULT_MS);
     }
     else{
         // 새로운 듀티 사이클 계산
@@ -521,15 +1239,8 @@ void set_duty_cycles_by_ratio(int n) {
         uint32_t new_b_duty = gamma_correct_duty_cycle(g_B_LED_duty_cycle/ 3 * (uint32_t)n);
 
 
-        // 새로운 듀티 사이클로 설정
-        set_duty_cycle(&g_timer3_ctrl, new_r_duty);
-        set_duty_cycle(&g_timer4_ctrl, new_g_duty);
-        set_duty_cycle(&g_timer6_ctrl, new_b_duty);
-
-        // 새로운 듀티 사이클을 전역 변수에 업데이트
-        g_R_LED_duty_cycle = new_r_duty;
-        g_G_LED_duty_cycle = new_g_duty;
-        g_B_LED_duty_cycle = new_b_duty;
+        // 새로운 듀티 사이클로 설정 (전역 변수도 rgb_fade_to 에서 업데이트)
+        rgb_fade_to(new_r_duty, new_g_duty, new_b_duty, RGB_FADE_DEFAULT_MS);
     }
 }
 
@@ -543,23 +1254,22 @@ void handle_btn_click(uint16_t btn_num){
         uart_write("1번 버튼,밝기 버튼 클릭횟수 초기화", (uint16_t)g_brightness_btn_cnt);
         g_color_btn_cnt++;
         g_color_btn_cnt = (g_color_btn_cnt)%3;
+        // R(0도) > G(120도) > B(240도), 색 엔진으로 화이트 밸런스 적용
+        color_state_t color = { COLOR_MODE_HSV, 0, 100, 100, 0 };
+        uint32_t duty[3];
         switch(g_color_btn_cnt){
             case 1: // R
-                set_duty_cycle(&g_timer3_ctrl, RGB_PWM_PERIOD);
-                set_duty_cycle(&g_timer4_ctrl, 0);
-                set_duty_cycle(&g_timer6_ctrl, 0);
+                color.hue = 0;
                 break;
             case 2: // G
-                set_duty_cycle(&g_timer3_ctrl, 0);
-                set_duty_cycle(&g_timer4_ctrl, RGB_PWM_PERIOD);
-                set_duty_cycle(&g_timer6_ctrl, 0);
+                color.hue = 120;
                 break;
             case 0: // B
-                set_duty_cycle(&g_timer3_ctrl, 0);
-                set_duty_cycle(&g_timer4_ctrl, 0);
-                set_duty_cycle(&g_timer6_ctrl, RGB_PWM_PERIOD);
+                color.hue = 240;
                 break;
         }
+        color_to_duty_cycles(&color, duty);
+        rgb_fade_to_fine(duty, RGB_FADE_DEFAULT_MS);
     }
 
     // 밝기 변경 버튼이면,
@@ -584,9 +1294,7 @@ void handle_btn_click(uint16_t btn_num){
                 break;
             case 0: // 꺼짐
                 uart_write("밝기 변경 버튼, 꺼짐", (uint16_t)g_brightness_btn_cnt);
-                R_GPT_DutyCycleSet(&g_timer3_ctrl, 0, GPT_IO_PIN_GTIOCA);
-                R_GPT_DutyCycleSet(&g_timer4_ctrl, 0, GPT_IO_PIN_GTIOCA);
-                R_GPT_DutyCycleSet(&g_timer6_ctrl, 0, GPT_IO_PIN_GTIOCA);
+                rgb_fade_to(0, 0, 0, RGB_FADE_DEFAULT_MS);
                 write_duty_cycle();
                 break;
         }
@@ -600,35 +1308,32 @@ void write_duty_cycle() {
     uart_write("B DutyCycle", (uint16_t)g_B_LED_duty_cycle);
 }
 
-// ■ 색상 변경 클릭 여부 확인
-void check_btn_clicked(bsp_io_port_pin_t BUTTON, bsp_io_level_t g_btn_level, ButtonState* g_btn_state){
-    uint16_t btn_num = BUTTON - 4; // S1은 핀 5번, S2는 핀 6번 (BUTTON은 핀 번호)
-
-    // 버튼 상태 읽어오기
-    err = R_IOPORT_PinRead(&g_ioport_ctrl, BUTTON, &g_btn_level);
-    if(err == FSP_SUCCESS){
-        _Bool button_pressed = !g_btn_level; // PRESS 되면, BTN_LEVEL = 0
-        switch(*g_btn_state){
-            case WAITING_FOR_PRESS:
-                if(button_pressed){
-                    uart_write("\033[32m버튼이 PRESS 되었습니다", btn_num); // 초록: \033[32m
-                    *g_btn_state = WAITING_FOR_RELEASE;
-                }
-                break;
+// ■ 버튼 눌림 여부 (PRESS 되면, BTN_LEVEL = 0)
+_Bool button_pressed(bsp_io_port_pin_t pin) {
+    bsp_io_level_t level;
+    if (R_IOPORT_PinRead(&g_ioport_ctrl, pin, &level) != FSP_SUCCESS) return false;
+    return level == BSP_IO_LEVEL_LOW;
+}
 
-                // PRESS 해제 되기를 기다리는 상태 (PRESS된 상태)
-            case WAITING_FOR_RELEASE:
-                if(!button_pressed){
-                    uart_write("\033[32m버튼이 RELEASE 되었습니다", btn_num);
-                    *g_btn_state = WAITING_FOR_PRESS;
-                    // 버튼 클릭 시, on/off 처리
-                    g_manual_control = true;  // 수동 제어 활성화
-                    handle_btn_click(btn_num);
-                }
-                break;
-        }
-    }
+// ■ 버튼 태스크: PRESS > RELEASE 가 되면 클릭 처리 (rt_buttons 가 읽은 값으로 확인)
+uint8_t button_task(task_t *t) {
+    button_task_t *b = (button_task_t *)t;
+
+    TASK_BEGIN(t);
+    while (1) {
+        // Click 을 기다림
+        TASK_WAIT_UNTIL(t, (g_buttons_pressed & (1U << b->num)) != 0, EVENT_BUTTON, 0);
+        uart_write("\033[32m버튼이 PRESS 되었습니다", b->num); // 초록: \033[32m
 
+        // 손 떼기를 기다림
+        TASK_WAIT_UNTIL(t, (g_buttons_pressed & (1U << b->num)) == 0, EVENT_BUTTON, 0);
+        uart_write("\033[32m버튼이 RELEASE 되었습니다", b->num);
+
+        // 버튼 클릭 시, on/off 처리
+        g_manual_control = true;  // 수동 제어 활성화
+        handle_btn_click(b->num);
+    }
+    TASK_END(t);
 }
 
 // ■ 밝기를 Duty Cycle로 변경 (밝기 명령어 범위: 0~100), (DutyCycle 범위: 0~RGB_PWM_PERIOD)
@@ -642,217 +1347,820 @@ uint32_t convert_brightness_to_duty_cycle(uint32_t brightness) {
 }
 
 
-// ■ 명령어 처리: 수신 확인 및 처리
+// ■ 바이너리 요청 실행: ASCII 파서에 HDR + 명령어 + TAIL 로 넣어서, 같은 명령어 테이블로 실행
+bin_status_t bin_execute(const uint8_t *payload, uint8_t len) {
+    cmd_result_t result = CMD_RESULT_NONE;
+    cmd_parser_reset(&g_bin_cmd_parser);
+    for (uint8_t i = 0; i < 3; i++) cmd_parser_feed(&g_bin_cmd_parser, (uint8_t)HEADER[i]);
+    for (uint8_t i = 0; i < len; i++) {
+        if (payload[i] == END_CHARACTER) return BIN_STATUS_CMD;
+        cmd_parser_feed(&g_bin_cmd_parser, payload[i]);
+    }
+    for (uint8_t i = 0; i < 4; i++) cmd_parser_feed(&g_bin_cmd_parser, (uint8_t)TAIL[i]);
+    result = cmd_parser_feed(&g_bin_cmd_parser, END_CHARACTER);
+    if (result != CMD_RESULT_READY) return BIN_STATUS_CMD;
+
+    // 응답은 상태 코드로 대신하므로, 실행 중 사람용 메시지는 출력하지 않음
+    g_uart_quiet = true;
+    _Bool ok = execute_frame(&g_bin_cmd_parser);
+    g_uart_quiet = false;
+    return ok ? BIN_STATUS_OK : BIN_STATUS_CMD;
+}
+
+// ■ 바이너리 수신 시간 초과 (타이머 휠 콜백, 시스템 틱 인터럽트에서)
+void bin_rx_timeout_tick(tw_timer_t *timer, void *arg) {
+    (void)timer; (void)arg;
+    g_bin_rx_timeout = true;
+    event_post(EVENT_UART_RX); // process_command() 에서 처리
+}
+
+// ■ 명령어 처리: 수신 링버퍼에서 명령어 한 줄씩 꺼내서 처리
 void process_command(){
-    // 수신 완료 했으면
-    if(g_uart_rx_complete){
-        // 다음의 새로운 데이터 입력 확인을 위해, 수신 미완료로 변경
-        g_uart_rx_complete = false;
-
-        // HDR명령어TAIL 형식인지 확인
-        if (strncmp((char *)g_rx_buffer, "HDR", 3) == 0 && strstr((char *)g_rx_buffer, "TAIL") != NULL) {
-            // 명령어 추출 (HDR와 TAIL 사이의 부분)
-            volatile uint8_t *start = g_rx_buffer + 3;      // "HDR" 이후 예) T10ONTAIL | B100TAIL
-            char *end = strstr((char *)g_rx_buffer, "TAIL");  // TAIL의 시작위치
-            *end = '\0';  // start에서 "TAIL"이 떨어져 나가서, 사용자 입력 명령어만 남음
-
-            // 이제 start는 사용자 입력 명령어 임
-            // 명령어의 첫 글자 확인
-            uint8_t first_cmd = start[0]; // R | G | B | T | A
-            volatile char* secnd_cmd;
-            uint32_t brightness; // 밝기
-            uint32_t minutes;    // 시간
-            switch(first_cmd){
-                case 'R':
-                    g_manual_control = true;  // 수동 제어 활성화
-                    brightness = convert_brightness_to_duty_cycle((uint32_t)atoi(start + 1));
-                    uart_write("\033[33mR LED 밝기 변경 명령어", (uint16_t)brightness);
-                    set_duty_cycle(&g_timer3_ctrl, brightness);
-                    write_duty_cycle();
-                    break;
-                case 'G':
-                    g_manual_control = true;  // 수동 제어 활성화
-                    brightness = convert_brightness_to_duty_cycle((uint32_t)atoi(start + 1));
-                    uart_write("\033[33mG LED 밝기 변경 명령어", (uint16_t)brightness);
-                    set_duty_cycle(&g_timer4_ctrl, brightness);
-                    write_duty_cycle();
-                    break;
-                case 'B':
-                    g_manual_control = true;  // 수동 제어 활성화
-                    brightness = convert_brightness_to_duty_cycle((uint32_t)atoi(start + 1)); // "B" 다음 숫자 추출
-                    uart_write("\033[33mB LED 밝기 변경 명령어", (uint16_t)brightness);
-                    set_duty_cycle(&g_timer6_ctrl, brightness);
-                    write_duty_cycle();
-                    break;
-                case 'T': {
-                    g_manual_control = true;  // 수동 제어 활성화
-                    uint8_t temp[3] = {0};  // 숫자 부분을 저장할 임시 버퍼 (최대 "99"까지)
-                    int i = 1;  // start[1]부터 숫자 부분 확인
-
-                    // 숫자 부분 추출 (최대 2자리)
-                    while (isdigit(start[i]) && i < 3) {
-                        temp[i - 1] = start[i];
-                        i++;
-                    }
-                    temp[i - 1] = '\0';  // 문자열 종료
-                    minutes = (uint32_t)atoi(temp);  // 문자열을 정수로 변환
-                    secnd_cmd = start + i;  // "ON" 또는 "OFF" 부분
-
-
-                    // 명령어가 ON 일 때,
-                    if (strcmp(secnd_cmd, "ON") == 0) {
-                        // LED가 이미 켜져있으면,
-                        if (is_RGB_LED_ON()) {
-                            uart_write("\033[37;41m이미 LED가 켜져 있습니다.", NO_VAR);
-                            break;
-                        }
-                        // LED가 꺼져있으면, LED ON 타이머 실행
-                        else set_timer(minutes, true);
-                    }
-
-                    // 명령어가 OFF 일 때,
-                    else if (strcmp(secnd_cmd, "OFF") == 0) {
-                        // LED가 이미 꺼져있으면,
-                        if (!is_RGB_LED_ON()) {
-                            uart_write("\033[37;41m이미 LED가 꺼져 있습니다.", NO_VAR);
-                            break;
-                        }
-                        // LED가 켜져있으면, LED OFF 타이머 실행
-                        else set_timer(minutes, false);
-
-                    }
-
-                    // ON/OFF 가 아니면, 잘못된 명령어
-                    else command_err_handle();
-                    for (i = 0; i < UART_RX_BUF_SIZE; i++) g_rx_buffer[i] = 0;
-                    break;
-                }
-
-                case 'S':
-                    g_timer_set = false;
-                    g_new_tick = 0;
-                    R_GPT_Reset(&g_timer3_ctrl);
-                    R_GPT_Reset(&g_timer4_ctrl);
-                    R_GPT_Reset(&g_timer6_ctrl);
-                    uart_write("타이머가 리셋되었습니다.", NO_VAR);
-                    for (uint8_t i = 0; i < UART_RX_BUF_SIZE; i++) g_rx_buffer[i] = 0;
-                    break;
-                case 'A':
-                {
-                    secnd_cmd = start + 1;  // "ON" 또는 "OFF" 부분
-                    if(strncmp(secnd_cmd, "ON", 2) == 0){
-                        uart_write("\033[35m자동모드+수동모드로 변환합니다.", NO_VAR);
-                        g_manual_control = false; // auto mode ON
-                    }
-                    else if(strncmp(secnd_cmd, "OFF", 3) == 0){
-                        uart_write("\033[35m수동모드로 변환합니다.", NO_VAR);
-                        g_manual_control = true; // auto mode OFF
-                    }
-                    else command_err_handle();
-
-                    break;
-                }
-
-                // LED ON / OFF (백색)
-                case 'O':
-                    secnd_cmd = start + 1;  // O -N 또는 FF
-                    if(strncmp(secnd_cmd, "N", 1) == 0) {
-                        RGB_LED_ON();
-                        g_is_RGB_LED_ON_by_cmd = true;
-                    }
-                    else if(strncmp(secnd_cmd, "FF", 2)==0) {
-                        RGB_LED_OFF();
-                        g_is_RGB_LED_ON_by_cmd = false;
-                    }
-                    else command_err_handle();
-                    break;
-
-                // 프로그램 종료 (EXIT)
-                case 'E':
-                    secnd_cmd = start + 1; // XIT
-                    if(strncmp(secnd_cmd, "XIT", 3) == 0) while(1);
-                    else command_err_handle();
-                    break;
-
-
-                default:
-                    command_err_handle();
-            }
+    // 수신 링버퍼/하드웨어 오버런이 있었으면 알림
+    uint32_t overrun = g_uart_rx_ring.overrun + g_uart_rx_ring.hw_overrun;
+    if (overrun != g_uart_rx_ring.reported) {
+        uart_write("\033[31mRX 오버런", (uint16_t)(overrun - g_uart_rx_ring.reported));
+        g_uart_rx_ring.reported = overrun;
+    }
+
+    // 응답을 보내지 못한 바이너리 프레임: 송신 링버퍼에 자리가 날 때까지 수신 링버퍼에서 더 꺼내지 않음
+    // (UART_EVENT_TX_COMPLETE 에서 EVENT_UART_RX 를 다시 보냄)
+    if (!bin_rx_finish(&g_bin_rx, &g_uart_tx_ring, bin_execute)) return;
+
+    // 바이너리 수신이 BIN_RX_TIMEOUT_MS 동안 멈춤: 받다 만 프레임 버리고 세션 끝
+    // (수신 링버퍼에 바이트가 남아 있으면 아직 도착 중 > 다음 바이트에서 타이머 다시 시작)
+    if (g_bin_rx_timeout) {
+        g_bin_rx_timeout = false;
+        if (g_uart_rx_ring.head == g_uart_rx_ring.tail) bin_rx_timeout(&g_bin_rx);
+    }
+
+    // 도착한 바이트를 모두 파서에 넣고, 종료 문자마다 명령어 실행 (여러 명령어가 한꺼번에 와도 순서대로 처리)
+    uint8_t data;
+    while (uart_rx_pop(&g_uart_rx_ring, &data)) {
+        // 바이너리 세션 중이거나, ASCII 명령어 시작 위치에서 0xA5 가 오면 바이너리 프로토콜
+        if (bin_rx_owns(&g_bin_rx, data, g_cmd_parser.state == CMD_STATE_HEADER && g_cmd_parser.match == 0)) {
+            bin_rx_feed(&g_bin_rx, data);
+            tw_start(&g_timer_wheel, &g_bin_rx_timer, BIN_RX_TIMEOUT_MS * TICK_PER_ONE_SEC / 1000U, 0);
+            if (!bin_rx_finish(&g_bin_rx, &g_uart_tx_ring, bin_execute)) return; // 응답 자리 없음
+            continue;
         }
-        // 명령어 형식과 다르면... (HDR명령어TAIL이 아니면)
-        else{
-            command_err_handle();
+
+        switch (cmd_parser_feed(&g_cmd_parser, data)) {
+            case CMD_RESULT_READY:
+                if (!execute_frame(&g_cmd_parser)) command_err_handle();
+                break;
+            case CMD_RESULT_ERROR:
+                command_err_handle();
+                break;
+            case CMD_RESULT_NONE:
+                break;
         }
+    }
+}
+
+/*** LED 트랜잭션: 한 프레임의 R/G/B 변경을 모았다가 한 번에 적용 ***/
+// HDR R50;G10;B40 TAIL 처럼 여러 색을 바꿀 때, 중간 색이 보이지 않고 응답도 한 번만 출력
+// ■ 변경할 듀티 저장 (channel 0: R, 1: G, 2: B, duty_cycle: fine 단위)
+void led_txn_stage(uint8_t channel, uint32_t duty_cycle) {
+    g_led_txn.duty[channel] = duty_cycle;
+    g_led_txn.changed |= (uint8_t)(1U << channel);
+}
+
+// ■ 저장된 듀티를 한 번에 적용하고, 응답 한 번 출력
+void led_txn_commit() {
+    static const char * const messages[3] = {
+        "\033[33mR LED 밝기 변경 명령어",
+        "\033[33mG LED 밝기 변경 명령어",
+        "\033[33mB LED 밝기 변경 명령어"
+    };
+    uint8_t changed = g_led_txn.changed;
+    if (changed == 0) return;
+    g_led_txn.changed = 0;
+
+    // 바뀌지 않은 채널은 현재 목표 듀티 그대로, 세 채널을 같이 변경 (F 로 지정한 시간 동안 페이드)
+    uint32_t to[3];
+    for (uint8_t ch = 0; ch < 3; ch++) to[ch] = (changed & (1U << ch)) ? g_led_txn.duty[ch] : g_rgb_fade.to[ch];
+    rgb_fade_to_fine(to, g_led_txn.fade_ms);
+
+    // 채널 하나만 바뀌었으면 기존 메시지, 여러 개면 일괄 변경 메시지
+    if (changed == 0x1 || changed == 0x2 || changed == 0x4) {
+        uint8_t ch = (changed == 0x1) ? 0 : (changed == 0x2) ? 1 : 2;
+        uart_write((char *)messages[ch], (uint16_t)RGB_FINE_ROUND(g_led_txn.duty[ch]));
+    }
+    else uart_write("\033[33mRGB LED 일괄 변경 명령어", NO_VAR);
+    write_duty_cycle();
+}
+
+/*** 명령어 핸들러 (명령어 테이블 COMMAND_LIST 에 등록) ***/
+// value: 숫자 인자, on: ON/OFF 인자 (명령어 테이블의 인자 형식에 따라 사용)
+
+// ■ R LED 밝기 (예: R50)
+void cmd_led_r(uint32_t value, _Bool on) {
+    (void)on;
+    g_manual_control = true;  // 수동 제어 활성화
+    led_txn_stage(0, RGB_FINE(convert_brightness_to_duty_cycle(value))); // 프레임이 끝나면 한 번에 적용
+}
+
+// ■ G LED 밝기 (예: G10)
+void cmd_led_g(uint32_t value, _Bool on) {
+    (void)on;
+    g_manual_control = true;  // 수동 제어 활성화
+    led_txn_stage(1, RGB_FINE(convert_brightness_to_duty_cycle(value))); // 프레임이 끝나면 한 번에 적용
+}
+
+// ■ B LED 밝기 (예: B40)
+void cmd_led_b(uint32_t value, _Bool on) {
+    (void)on;
+    g_manual_control = true;  // 수동 제어 활성화
+    led_txn_stage(2, RGB_FINE(convert_brightness_to_duty_cycle(value))); // 프레임이 끝나면 한 번에 적용
+}
+
+// ■ ON/OFF 타이머 (예: T10ON, T10OFF)
+void cmd_timer(uint32_t value, _Bool on) {
+    if (value > LED_TIMER_MAX_MIN) {
+        uart_write("\033[37;41m예약 시간이 너무 깁니다. 최대 (분)", LED_TIMER_MAX_MIN);
+        return;
+    }
+    g_manual_control = true;  // 수동 제어 활성화
+    if (on) {
+        // LED가 이미 켜져있으면,
+        if (is_RGB_LED_ON()) uart_write("\033[37;41m이미 LED가 켜져 있습니다.", NO_VAR);
+        // LED가 꺼져있으면, LED ON 타이머 실행
+        else set_timer(value, true);
+    }
+    else {
+        // LED가 이미 꺼져있으면,
+        if (!is_RGB_LED_ON()) uart_write("\033[37;41m이미 LED가 꺼져 있습니다.", NO_VAR);
+        // LED가 켜져있으면, LED OFF 타이머 실행
+        else set_timer(value, false);
+    }
+}
+
+// ■ 타이머 리셋 (S)
+void cmd_timer_reset(uint32_t value, _Bool on) {
+    (void)value; (void)on;
+    event_post(EVENT_TIMER_RESET);
+    uart_write("타이머가 리셋되었습니다.", NO_VAR);
+}
 
+// ■ 자동모드 (AON, AOFF)
+void cmd_auto(uint32_t value, _Bool on) {
+    (void)value;
+    if (on) {
+        uart_write("\033[35m자동모드+수동모드로 변환합니다.", NO_VAR);
+        g_manual_control = false; // auto mode ON
+        g_light_force = true;     // 현재 밝기 구간 적용 (확인 블록 뒤)
+        event_post(EVENT_LIGHT);
     }
+    else {
+        uart_write("\033[35m수동모드로 변환합니다.", NO_VAR);
+        g_manual_control = true; // auto mode OFF
+    }
+}
+
+// ■ LED ON (백색)
+void cmd_led_on(uint32_t value, _Bool on) {
+    (void)value; (void)on;
+    RGB_LED_ON();
+    g_is_RGB_LED_ON_by_cmd = true;
+}
+
+// ■ LED OFF
+void cmd_led_off(uint32_t value, _Bool on) {
+    (void)value; (void)on;
+    RGB_LED_OFF();
+    g_is_RGB_LED_ON_by_cmd = false;
+}
+
+// ■ ADC 하드웨어 오버샘플링 횟수 (예: O4, O1 = 끄기)
+void cmd_oversample(uint32_t value, _Bool on) {
+    (void)on;
+    if (value == 0) value = 1;
+    for (uint8_t i = 0; i < ADC_OVERSAMPLE_MODE_COUNT; i++) {
+        if (g_adc_oversample_modes[i].count != value) continue;
+
+        err = adc_set_oversample(i);
+        if (err == FSP_SUCCESS) uart_write("\033[35mADC 오버샘플링 횟수", (uint16_t)value);
+        else uart_write("\033[37;41mADC 오버샘플링 설정 실패", err);
+        return;
+    }
+    uart_write("\033[37;41mADC 오버샘플링 횟수는 1, 2, 4, 16 중 하나", (uint16_t)value);
+}
+
+// ■ 조도센서 통계 (ADC): 이동 평균 구간의 평균/최솟값/최댓값/분산, 버린 블록 수
+void cmd_adc_stats(uint32_t value, _Bool on) {
+    (void)value; (void)on;
+    uint16_t min, max;
+    uint32_t variance;
+    adc_avg_buf_scan(&g_adc_buffer, &min, &max, &variance);
+    uart_write("\033[36m조도 평균", adc_avg_buf_mean(&g_adc_buffer));
+    uart_write("\033[36m조도 최솟값", min);
+    uart_write("\033[36m조도 최댓값", max);
+    uart_write("\033[36m조도 분산", (uint16_t)((variance < NO_VAR) ? variance : NO_VAR - 1));
+    uart_write("\033[36mADC 버린 블록", (uint16_t)g_adc_blocks.overrun);
+}
+
+// ■ 조도 필터 처리 시간 (Q): 블록 하나를 C 코드 / MACL (있는 MCU 만) 로 처리한 CPU 사이클, 두 출력 비교
+//   동작 중인 필터 상태는 건드리지 않음 (따로 만든 필터로 측정)
+void cmd_filter_bench(uint32_t value, _Bool on) {
+    (void)value; (void)on;
+    static light_filter_t lf;
+    static q31_t src[ADC_BLOCK_SIZE];
+    for (uint16_t i = 0; i < ADC_BLOCK_SIZE; i++) {
+        src[i] = (q31_t)((uint32_t)(2048U + (i & 7U) * 64U) << LIGHT_FILTER_Q31_SHIFT);
+    }
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    q31_t out_c;
+    light_filter_init(&lf);
+    memcpy(lf.buf, src, sizeof(src));
+    FSP_CRITICAL_SECTION_ENTER;
+    uint32_t start = DWT->CYCCNT;
+    q31_biquad_df1_c(g_light_biquad_coeffs, lf.biquad_state, LIGHT_FILTER_BIQUAD_STAGES, LIGHT_FILTER_POST_SHIFT,
+                     lf.buf, lf.buf, ADC_BLOCK_SIZE);
+    q31_fir_decimate_c(lf.fir_coeffs, lf.fir_state, LIGHT_FILTER_FIR_TAPS, LIGHT_FILTER_DECIMATION,
+                       lf.buf, &out_c, ADC_BLOCK_SIZE);
+    uint32_t c_cycles = DWT->CYCCNT - start;
+    FSP_CRITICAL_SECTION_EXIT;
+    uart_write("\033[36m조도 필터 C 코드 (사이클/블록)", (uint16_t)((c_cycles < NO_VAR) ? c_cycles : NO_VAR - 1));
+
+#if Q31_FILTER_USE_MACL
+    q31_t out_macl;
+    light_filter_init(&lf);
+    memcpy(lf.buf, src, sizeof(src));
+    FSP_CRITICAL_SECTION_ENTER;
+    start = DWT->CYCCNT;
+    q31_biquad_process(&lf.biquad, lf.buf, lf.buf, ADC_BLOCK_SIZE);
+    q31_fir_decimate_process(&lf.fir, lf.buf, &out_macl, ADC_BLOCK_SIZE);
+    uint32_t macl_cycles = DWT->CYCCNT - start;
+    FSP_CRITICAL_SECTION_EXIT;
+    uart_write("\033[36m조도 필터 MACL (사이클/블록)", (uint16_t)((macl_cycles < NO_VAR) ? macl_cycles : NO_VAR - 1));
+    uart_write("\033[36mC 코드 / MACL 출력 같음 (1: 같음)", (uint16_t)(out_c == out_macl));
+#else
+    (void)out_c;
+    uart_write("\033[36m이 MCU 는 MACL 없음 (C 코드로 동작)", NO_VAR);
+#endif
+}
+
+// ■ 자동 조명 어두움 기준 (예: L1000, 이 값 이하면 LED 켜기)
+void cmd_light_low(uint32_t value, _Bool on) {
+    (void)on;
+    if (adc_window_set_thresholds(value, g_light_threshold_high)) uart_write("\033[35m자동조명 어두움 기준", (uint16_t)value);
+    else uart_write("\033[37;41m어두움 기준은 밝음 기준보다 작아야 함 (간격 100 이상)", (uint16_t)value);
+}
+
+// ■ 자동 조명 밝음 기준 (예: H3000, 이 값 이상이면 LED 끄기)
+void cmd_light_high(uint32_t value, _Bool on) {
+    (void)on;
+    if (adc_window_set_thresholds(g_light_threshold_low, value)) uart_write("\033[35m자동조명 밝음 기준", (uint16_t)value);
+    else uart_write("\033[37;41m밝음 기준은 어두움 기준보다 커야 함 (간격 100 이상, 최대 4095)", (uint16_t)value);
+}
+
+// ■ 페이드 곡선 (예: C3, 다음 페이드부터 적용)
+void cmd_fade_curve(uint32_t value, _Bool on) {
+    (void)on;
+    if (value < FADE_EASE_COUNT) {
+        g_fade_ease = (fade_ease_t)value;
+        uart_write("\033[35m페이드 곡선", (uint16_t)value);
+    }
+    else uart_write("\033[37;41m페이드 곡선은 0 ~ 3", (uint16_t)value);
+}
+
+// ■ 색온도 (예: K2700, K6500F2000)
+void cmd_color_temp(uint32_t value, _Bool on) {
+    (void)on;
+    g_color.mode = COLOR_MODE_CCT;
+    g_color.kelvin = (uint16_t)value; // 범위 밖은 color_cct_to_rgb() 에서 끝값으로
+    color_stage();
+}
+
+// ■ 색상 (예: U120, 0 ~ 359)
+void cmd_color_hue(uint32_t value, _Bool on) {
+    (void)on;
+    g_color.mode = COLOR_MODE_HSV;
+    g_color.hue = (uint16_t)(value % COLOR_HUE_MAX);
+    color_stage();
+}
+
+// ■ 채도 (예: Y80, 0 ~ 100)
+void cmd_color_sat(uint32_t value, _Bool on) {
+    (void)on;
+    g_color.mode = COLOR_MODE_HSV;
+    g_color.sat = (uint8_t)((value > COLOR_PERCENT) ? COLOR_PERCENT : value);
+    color_stage();
+}
+
+// ■ 밝기 (예: V50, 0 ~ 100, 지금 색 모드 그대로)
+void cmd_color_val(uint32_t value, _Bool on) {
+    (void)on;
+    g_color.val = (uint8_t)((value > COLOR_PERCENT) ? COLOR_PERCENT : value);
+    color_stage();
+}
+
+// ■ 화이트 밸런스 (예: W90R, 채널 최대 듀티 %, 다음 색 명령어부터 적용)
+void cmd_white_balance_r(uint32_t value, _Bool on) {
+    (void)on;
+    g_white_balance[0] = (uint8_t)((value > 100) ? 100 : value);
+    uart_write("\033[35m화이트 밸런스 R", g_white_balance[0]);
+}
+
+void cmd_white_balance_g(uint32_t value, _Bool on) {
+    (void)on;
+    g_white_balance[1] = (uint8_t)((value > 100) ? 100 : value);
+    uart_write("\033[35m화이트 밸런스 G", g_white_balance[1]);
+}
+
+void cmd_white_balance_b(uint32_t value, _Bool on) {
+    (void)on;
+    g_white_balance[2] = (uint8_t)((value > 100) ? 100 : value);
+    uart_write("\033[35m화이트 밸런스 B", g_white_balance[2]);
+}
+
+// ■ CPU 부하 (CPU): 지난 1초 동안 인터럽트가 쓴 CPU 시간, WFI 로 잠든 시간, 명령어 처리 지연
+void cmd_cpu_load(uint32_t value, _Bool on) {
+    (void)value; (void)on;
+    uint32_t per_10000 = (uint32_t)(((uint64_t)g_cpu_load.last_busy * 10000U) / SystemCoreClock);
+    uart_write("\033[36m인터럽트 CPU 부하 (0.01%)", (uint16_t)per_10000);
+    uart_write("\033[36m인터럽트 횟수 (/초, 65535 이상은 65535)", (uint16_t)((g_cpu_load.last_irqs < NO_VAR) ? g_cpu_load.last_irqs : NO_VAR - 1));
+    uint32_t idle_10000 = (uint32_t)(((uint64_t)g_cpu_load.last_idle * 10000U) / SystemCoreClock);
+    uart_write("\033[36mWFI 잠든 시간 (0.01%)", (uint16_t)idle_10000);
+    uint32_t latency_us = g_cpu_load.last_latency / (SystemCoreClock / 1000000U);
+    uart_write("\033[36mUART 수신 > 처리 최대 지연 (us)", (uint16_t)((latency_us < NO_VAR) ? latency_us : NO_VAR - 1));
+    uart_write("\033[36mUART 송신 버퍼 최대 사용 (바이트)", g_uart_tx_ring.max_used);
+    uart_write("\033[36mUART 송신 버퍼 크기 (바이트)", UART_TX_RING_SIZE);
+    uint32_t dropped = g_uart_tx_ring.dropped;
+    uart_write("\033[36mUART 송신 초과 드롭 누적 (바이트)", (uint16_t)((dropped < NO_VAR) ? dropped : NO_VAR - 1));
+    uart_write("\033[36mUART 송신 방식 (0: TXI 인터럽트, 1: DTC)", g_uart_tx_ring.transfer_mode);
+    uint32_t chunks = g_uart_tx_ring.chunks;
+    uart_write("\033[36mUART 송신 구간 수 (65535 이상은 65535)", (uint16_t)((chunks < NO_VAR) ? chunks : NO_VAR - 1));
+    uart_write("\033[36m바이너리 CRC 오류", (uint16_t)((g_bin_rx.crc_errors < NO_VAR) ? g_bin_rx.crc_errors : NO_VAR - 1));
+    uart_write("\033[36m바이너리 길이 오류", (uint16_t)((g_bin_rx.len_errors < NO_VAR) ? g_bin_rx.len_errors : NO_VAR - 1));
+    uart_write("\033[36m바이너리 수신 시간 초과", (uint16_t)((g_bin_rx.timeouts < NO_VAR) ? g_bin_rx.timeouts : NO_VAR - 1));
+    uart_write("\033[36m바이너리 응답 대기 (송신 버퍼 가득)", (uint16_t)((g_bin_rx.reply_waits < NO_VAR) ? g_bin_rx.reply_waits : NO_VAR - 1));
+}
+
+// ■ 주기 항목 통계 (P0~P3: 항목 하나, P9: 초기화)
+void cmd_rt_stats(uint32_t value, _Bool on) {
+    (void)on;
+    uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+
+    if (value == RT_STATS_RESET) {
+        for (uint8_t i = 0; i < RT_TASK_COUNT; i++) {
+            rt_task_stat_t *st = &g_rt_stats[i];
+            FSP_CRITICAL_SECTION_DEFINE;
+            FSP_CRITICAL_SECTION_ENTER;
+            st->runs = 0;
+            st->exec_sum = 0;
+            st->exec_max = 0;
+            st->latency_min = UINT32_MAX;
+            st->latency_max = 0;
+            st->overruns = 0;
+            st->misses = 0;
+            FSP_CRITICAL_SECTION_EXIT;
+        }
+        uart_write("\033[35m주기 항목 통계를 초기화했습니다.", NO_VAR);
+        return;
+    }
+    if (value >= RT_TASK_COUNT) {
+        uart_write("\033[37;41m주기 항목 번호는 0 ~", RT_TASK_COUNT - 1);
+        return;
+    }
+
+    const rt_task_cfg_t *cfg = &g_rt_tasks[value];
+    const rt_task_stat_t *st = &g_rt_stats[value];
+    uint32_t avg = (st->runs != 0) ? (uint32_t)(st->exec_sum / st->runs) : 0;
+    uint32_t latency_min = (st->latency_min <= st->latency_max) ? st->latency_min : st->latency_max; // 실행 전이면 0
+    uint32_t jitter = st->latency_max - latency_min;
+    uart_write((char *)cfg->name, NO_VAR);
+    uart_write("\033[36m주기 / 마감 (ms)", (uint16_t)cfg->period_ms);
+    uart_write("\033[36m실행 횟수 (65535 이상은 65535)", (uint16_t)((st->runs < NO_VAR) ? st->runs : NO_VAR - 1));
+    uart_write("\033[36m평균 실행 (us)", (uint16_t)(avg / cycles_per_us));
+    uart_write("\033[36m최대 실행 (us)", (uint16_t)((st->exec_max / cycles_per_us < NO_VAR) ? st->exec_max / cycles_per_us : NO_VAR - 1));
+    uart_write("\033[36m예산 (us)", (uint16_t)cfg->budget_us);
+    uart_write("\033[36m최소 시작 지연 (us)", (uint16_t)((latency_min / cycles_per_us < NO_VAR) ? latency_min / cycles_per_us : NO_VAR - 1));
+    uart_write("\033[36m최대 시작 지연 (us)", (uint16_t)((st->latency_max / cycles_per_us < NO_VAR) ? st->latency_max / cycles_per_us : NO_VAR - 1));
+    uart_write("\033[36m시작 지터 (최대 - 최소, us)", (uint16_t)((jitter / cycles_per_us < NO_VAR) ? jitter / cycles_per_us : NO_VAR - 1));
+    uart_write("\033[36m예산 초과", (uint16_t)((st->overruns < NO_VAR) ? st->overruns : NO_VAR - 1));
+    uart_write("\033[36m마감 놓침", (uint16_t)((st->misses < NO_VAR) ? st->misses : NO_VAR - 1));
+}
+
+// ■ 디더링 (DON, DOFF)
+void cmd_dither(uint32_t value, _Bool on) {
+    (void)value;
+    rgb_dither_enable(on);
+    uart_write(on ? "\033[35m디더링 ON (약 16비트 밝기)" : "\033[35m디더링 OFF", NO_VAR);
+}
+
+// ■ 프로그램 종료 (EXIT)
+void cmd_exit(uint32_t value, _Bool on) {
+    (void)value; (void)on;
+    while(1);
+}
+
+/***
+ 명령어 테이블
+ X(이름, 인자 형식, 핸들러, 도움말)
+ - 이름의 첫 글자가 opcode, 나머지 글자는 문자 인자 앞부분과 비교 (예: "ON" = 'O' + "N", "EXIT" = 'E' + "XIT")
+ - 새 명령어는 여기에 한 줄 추가 (도움말도 command_err_handle() 에서 자동으로 출력)
+ - 같은 opcode 를 쓰는 명령어는 연속해서 등록
+ ***/
+#define COMMAND_LIST(X) \
+    X("R",    CMD_ARG_NUMBER_FADE,  cmd_led_r,       "\033[37m[명령어] R LED 밝기 (0~100), 페이드(ms): R50 | R50F2000") \
+    X("G",    CMD_ARG_NUMBER_FADE,  cmd_led_g,       "\033[37m[명령어] G LED 밝기 (0~100), 페이드(ms): G10 | G10F2000") \
+    X("B",    CMD_ARG_NUMBER_FADE,  cmd_led_b,       "\033[37m[명령어] B LED 밝기 (0~100), 페이드(ms): B40 | B40F2000") \
+    X("T",    CMD_ARG_NUMBER_ONOFF, cmd_timer,       "\033[37m[명령어] 타이머 (분): T10ON | T10OFF") \
+    X("S",    CMD_ARG_NONE,         cmd_timer_reset, "\033[37m[명령어] 타이머 리셋: S") \
+    X("A",    CMD_ARG_ONOFF,        cmd_auto,        "\033[37m[명령어] 자동모드: AON | AOFF") \
+    X("ADC",  CMD_ARG_NONE,         cmd_adc_stats,   "\033[37m[명령어] 조도센서 통계: ADC") \
+    X("Q",    CMD_ARG_NONE,         cmd_filter_bench, "\033[37m[명령어] 조도 필터 처리 시간 (C 코드 / MACL): Q") \
+    X("ON",   CMD_ARG_NONE,         cmd_led_on,      "\033[37m[명령어] LED 켜기: ON") \
+    X("OFF",  CMD_ARG_NONE,         cmd_led_off,     "\033[37m[명령어] LED 끄기: OFF") \
+    X("O",    CMD_ARG_NUMBER,       cmd_oversample,  "\033[37m[명령어] 조도센서 오버샘플링 (1, 2, 4, 16): O4") \
+    X("L",    CMD_ARG_NUMBER,       cmd_light_low,   "\033[37m[명령어] 자동조명 어두움 기준 (0~4095): L1000") \
+    X("H",    CMD_ARG_NUMBER,       cmd_light_high,  "\033[37m[명령어] 자동조명 밝음 기준 (0~4095): H3000") \
+    X("C",    CMD_ARG_NUMBER,       cmd_fade_curve,  "\033[37m[명령어] 페이드 곡선 (0:선형 1:가속 2:감속 3:가속+감속): C3") \
+    X("CPU",  CMD_ARG_NONE,         cmd_cpu_load,    "\033[37m[명령어] 인터럽트 CPU 부하 / UART 상태: CPU") \
+    X("P",    CMD_ARG_NUMBER,       cmd_rt_stats,    "\033[37m[명령어] 주기 항목 통계 (0:CMD 1:BTN 2:ADC 3:TASK, 9:초기화): P0") \
+    X("D",    CMD_ARG_ONOFF,        cmd_dither,      "\033[37m[명령어] 디더링 (어두운 밝기 단계 세분화): DON | DOFF") \
+    X("K",    CMD_ARG_NUMBER_FADE,  cmd_color_temp,  "\033[37m[명령어] 색온도 (1000~10000K), 페이드(ms): K2700 | K6500F2000") \
+    X("U",    CMD_ARG_NUMBER_FADE,  cmd_color_hue,   "\033[37m[명령어] 색상 (0~359): U120 | U120F1000") \
+    X("Y",    CMD_ARG_NUMBER_FADE,  cmd_color_sat,   "\033[37m[명령어] 채도 (0~100): Y80") \
+    X("V",    CMD_ARG_NUMBER_FADE,  cmd_color_val,   "\033[37m[명령어] 밝기 (0~100): V50 | V50F1000") \
+    X("WR",   CMD_ARG_NUMBER,       cmd_white_balance_r, "\033[37m[명령어] 화이트 밸런스 R (0~100%): W90R") \
+    X("WG",   CMD_ARG_NUMBER,       cmd_white_balance_g, "\033[37m[명령어] 화이트 밸런스 G (0~100%): W80G") \
+    X("WB",   CMD_ARG_NUMBER,       cmd_white_balance_b, "\033[37m[명령어] 화이트 밸런스 B (0~100%): W100B") \
+    X("EXIT", CMD_ARG_NONE,         cmd_exit,        "\033[37m[명령어] 프로그램 종료: EXIT")
+
+#define COMMAND_DESC(name, args, handler, help) { name, sizeof(name) - 1, args, handler, help },
+const command_desc_t g_command_table[] = { COMMAND_LIST(COMMAND_DESC) };
+#define COMMAND_COUNT (sizeof(g_command_table) / sizeof(g_command_table[0]))
+
+// opcode(ASCII) > 명령어 테이블에서 그 opcode 를 쓰는 첫 번째 명령어 번호 + 1 (0: 없는 opcode)
+uint8_t g_command_index[128];
+
+// ■ 명령어 인덱스 생성 (부팅 시 한 번, 이후 opcode 찾기는 배열 한 번 읽기)
+void command_table_init() {
+    memset(g_command_index, 0, sizeof(g_command_index));
+    for (uint8_t i = COMMAND_COUNT; i > 0; i--) {
+        g_command_index[(uint8_t)g_command_table[i - 1].name[0] & 0x7F] = i; // 뒤에서부터 > 같은 opcode 중 첫 번째가 남음
+    }
+}
+
+// ■ 명령어 찾기: 테이블에서 이름과 인자 형식이 맞는 명령어 (없으면 false)
+_Bool command_resolve(const command_t *cmd, const command_desc_t **p_desc, _Bool *p_on){
+    uint8_t index = (cmd->opcode < 128) ? g_command_index[cmd->opcode] : 0;
+    if (index == 0) return false;
+
+    // 같은 opcode 를 쓰는 명령어들 중에서 이름이 맞는 것 찾기 (대부분 1개)
+    for (const command_desc_t *desc = &g_command_table[index - 1];
+         desc < &g_command_table[COMMAND_COUNT] && desc->name[0] == (char)cmd->opcode; desc++) {
+        uint8_t rest = (uint8_t)(desc->name_len - 1); // 이름에서 opcode 뒤 글자 수
+        if (cmd->word_len < rest || strncmp(cmd->word, desc->name + 1, rest) != 0) continue;
+        const char *arg = cmd->word + rest; // 이름 뒤에 남은 문자 인자
+        if (cmd->has_fade && desc->args != CMD_ARG_NUMBER_FADE) continue; // 페이드 시간은 밝기 명령어만
+
+        // 인자 형식 확인
+        _Bool on = false;
+        switch (desc->args) {
+            case CMD_ARG_NONE:
+            case CMD_ARG_NUMBER:
+            case CMD_ARG_NUMBER_FADE:
+                if (arg[0] != '\0') continue;
+                break;
+            case CMD_ARG_ONOFF:
+            case CMD_ARG_NUMBER_ONOFF:
+                if (strcmp(arg, "ON") == 0) on = true;
+                else if (strcmp(arg, "OFF") != 0) continue;
+                break;
+        }
+        *p_desc = desc;
+        *p_on = on;
+        return true;
+    }
+    return false;
+}
+
+// ■ 프레임 실행: 모든 명령어를 먼저 확인하고 (하나라도 틀리면 아무것도 실행 안 하고 false),
+//   순서대로 실행한 뒤, LED 변경은 마지막에 한 번에 적용
+_Bool execute_frame(const cmd_parser_t *p){
+    const command_desc_t *descs[CMD_BATCH_MAX];
+    _Bool ons[CMD_BATCH_MAX];
+    for (uint8_t i = 0; i < p->count; i++) {
+        if (!command_resolve(&p->cmds[i], &descs[i], &ons[i])) return false;
+    }
+
+    g_led_txn.changed = 0;
+    g_led_txn.fade_ms = 0;
+    for (uint8_t i = 0; i < p->count; i++) {
+        if (p->cmds[i].has_fade) g_led_txn.fade_ms = p->cmds[i].fade_ms;
+        descs[i]->handler(p->cmds[i].value, ons[i]);
+    }
+    led_txn_commit();
+    return true;
 }
 
 // ■ 명령어 에러 처리: 형식에 맞지 않는 명령어 처리
 void command_err_handle() {
     uart_write("\033[37;41m명령어 형식을 확인해주세요.", NO_VAR);
-//    uart_write("\033[37현재 입력된 명령어 : ", NO_VAR);
-//    uart_write((char *)g_rx_buffer, NO_VAR);
-    uart_write("\033[37mHDR명령어TAIL", NO_VAR);
-    uart_write("\033[37m[명령어] LED제어: R50 | G10 | B40", NO_VAR);
-    uart_write("\033[37m[명령어] 타이머 : T10", NO_VAR);
-    g_rx_index = 0;  // 인덱스 초기화
+    uart_write("\033[37mHDR명령어TAIL | HDR명령어;명령어;...TAIL", NO_VAR);
+    for (uint8_t i = 0; i < COMMAND_COUNT; i++) uart_write((char *)g_command_table[i].help, NO_VAR);
 }
 
 
-// ■ GPT 콜백 함수
+// ■ GPT3 콜백 함수 (디더링 ON 일 때만 인터럽트 허용, PWM 주기마다)
 void g_timer_callback(timer_callback_args_t *p_args) {
     (void)p_args; // 이벤트 사용하지 않음
+    uint32_t start = DWT->CYCCNT;
 
-    // 타이머가 설정되어 있고, 남은 시간이 있는 경우
-    if (g_timer_set && (g_new_minutes > 0 || g_new_seconds > 0)) {
-        g_new_tick++; // 타이머 카운트 증가
-
-        // 1초마다
-        if (g_new_tick >= TICK_PER_ONE_SEC) {
-            g_new_tick = 0;
-            if (g_new_seconds > 0) {
-                g_new_seconds--;
-            } else if (g_new_minutes > 0) {
-                g_new_minutes--;
-                g_new_seconds = 59;
-            }
+    // 디더링: PWM 주기마다 비교값 선택
+    if (g_rgb_dither) rgb_dither_step();
 
-            g_uart_tick_output_flag = true; // UART 출력을 위한 플래그 설정
-        }
-    }
+    cpu_load_add(start);
+}
 
-    // 남은 시간이 0이 되었을 때
-    if (g_new_minutes == 0 && g_new_seconds == 0 && g_timer_set) {
-        g_timer_set = false; // 타이머 종료
-        if (g_is_RGB_LED_ON_by_cmd) {
-            RGB_LED_ON(); // LED 점등
-        } else {
-            RGB_LED_OFF(); // LED 소등
-        }
+// ■ 시스템 틱 시작 (SysTick, SYSTEM_TICK_HZ) + 타이머 휠 + CPU 부하 측정용 사이클 카운터
+void system_tick_init() {
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    tw_init(&g_timer_wheel, 0);
+    tw_timer_init(&g_fade_timer, fade_timer_tick, NULL);
+    tw_timer_init(&g_adc_poll_timer, adc_poll_tick, NULL);
+    tw_timer_init(&g_bin_rx_timer, bin_rx_timeout_tick, NULL);
+
+    SysTick_Config(SystemCoreClock / SYSTEM_TICK_HZ);
+    NVIC_SetPriority(SysTick_IRQn, g_timer3_cfg.cycle_end_ipl);
+}
+
+// ■ SysTick 인터럽트 (startup.c 의 weak 핸들러를 대신함)
+void SysTick_Handler(void) {
+    uint32_t start = DWT->CYCCNT;
+    system_tick();
+    cpu_load_add(start);
+
+    // 1초마다 CPU 부하 결과 갱신
+    if (++g_cpu_load.ticks >= SYSTEM_TICK_HZ) {
+        g_cpu_load.last_busy = g_cpu_load.busy;
+        g_cpu_load.last_irqs = g_cpu_load.irqs;
+        g_cpu_load.last_idle = g_cpu_load.idle;
+        g_cpu_load.last_latency = g_cpu_load.latency;
+        g_cpu_load.busy = 0;
+        g_cpu_load.irqs = 0;
+        g_cpu_load.idle = 0;
+        g_cpu_load.latency = 0;
+        g_cpu_load.ticks = 0;
     }
 }
 
-// ■ 타이머 설정을 초기화하는 함수
+// ■ 인터럽트 본문에서 쓴 사이클 더하기 (start: 시작할 때의 DWT->CYCCNT)
+void cpu_load_add(uint32_t start) {
+    g_cpu_load.busy += DWT->CYCCNT - start;
+    g_cpu_load.irqs++;
+}
+
+// ■ 시스템 틱 (SYSTEM_TICK_HZ 마다): 타이머 휠 한 틱 (만료된 타이머 콜백 호출)
+void system_tick() {
+    tw_tick(&g_timer_wheel);
+}
+
+// ■ LED 페이드 한 단계 (타이머 휠 콜백, 페이드 중에만 RGB_FADE_STEP_HZ)
+void fade_timer_tick(tw_timer_t *timer, void *arg) {
+    (void)timer; (void)arg;
+    rgb_fade_step();
+}
+
+// ■ 타이머 설정을 초기화하는 함수 (이전 예약이 있으면 취소하고 새로 예약, 카운트다운은 led_timer_task)
 void set_timer(uint32_t minutes, _Bool led_on) {
+    if (g_led_timer_task.active) uart_write("\033[33m[타이머] 이전 예약을 취소합니다.", NO_VAR);
     uart_write(led_on ? "[타이머] LED ON 예약" : "[타이머] LED OFF 예약", (uint16_t)minutes);
-    g_timer_target_ticks = minutes * TICK_PER_ONE_MIN;  // 타이머 목표 설정
-    g_new_tick = 0; // 타이머 카운트 초기화
-    g_timer_set = true;
     g_is_RGB_LED_ON_by_cmd = led_on;
+    led_timer_set(&g_led_timer_task, minutes);
+    event_post(EVENT_TIMER_SET);
+}
+
+// ■ 예약 카운트다운 1초마다 (led_timer_task)
+void led_timer_second(uint32_t remaining) {
+    write_time(remaining);
+}
+
+// ■ 예약 시간이 됨 (led_timer_task)
+void led_timer_expire() {
+    if (g_is_RGB_LED_ON_by_cmd) {
+        RGB_LED_ON(); // LED 점등
+    } else {
+        RGB_LED_OFF(); // LED 소등
+    }
+}
+
+// ■ 자동 조명 태스크: 밝기 구간이 바뀌면 (ADC 윈도우 비교), 필터 출력으로 LIGHT_SETTLE_BLOCKS 블록 동안 구간 확인
+uint8_t light_task(task_t *t) {
+    light_task_t *l = (light_task_t *)t;
+
+    TASK_BEGIN(t);
+    while (1) {
+        TASK_AWAIT(t, EVENT_LIGHT);
+
+        l->settle = LIGHT_SETTLE_BLOCKS;
+        while (l->settle > 0) {
+            TASK_AWAIT(t, EVENT_ADC | EVENT_LIGHT);
+            if (t->events & EVENT_LIGHT) l->settle = LIGHT_SETTLE_BLOCKS; // 확인 중에 또 바뀜 > 처음부터
+            if (t->events & EVENT_ADC) {
+                l->settle--;
+                // 강제 적용은 필터가 안정된 마지막 확인 블록으로 (부팅 직후 필터 과도응답으로 잘못 켜지지 않게)
+                if (!g_light_force || l->settle == 0) light_update(g_adc_data);
+            }
+        }
+    }
+    TASK_END(t);
+}
+
+// ■ 태스크 시작 (시스템 틱 / 타이머 휠 초기화 뒤)
+void tasks_init() {
+    task_sched_init(&g_timer_wheel, event_post, EVENT_TASK);
+    led_timer_init(&g_led_timer_task, EVENT_TIMER_SET, EVENT_TIMER_RESET, TICK_PER_ONE_SEC, led_timer_second, led_timer_expire);
+    task_init(&g_light_task.task, light_task);
+    task_init(&g_color_btn_task.task, button_task);
+    task_init(&g_brightness_btn_task.task, button_task);
+
+    // 처음 밝기 구간: 윈도우 비교는 구간이 바뀔 때만 알리므로, 중간 밝기에서 켜지면 이벤트가 오지 않음
+    // > 필터 출력으로 한 번 확인해서 적용 (pwm_init 은 최대 밝기로 시작)
+    g_light_force = true;
+    event_post(EVENT_LIGHT);
+}
+
+// ■ 예약 남은 시간 출력
+void write_time(uint32_t sec) {
+    uart_tx_msg_t msg;
+    tx_msg_begin(&g_uart_tx_ring, &msg);
+    tx_msg_str(&msg, "\033[A\r\033[K");
+    tx_msg_uint(&msg, sec / 60U, 2);
+    tx_msg_str(&msg, ":");
+    tx_msg_uint(&msg, sec % 60U, 2);
+    tx_msg_end(&msg);
+}
+
+// ■ 메인 루프 이벤트 올리기 (인터럽트, 메인 루프 어디서나)
+void event_post(uint32_t events) {
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    FSP_CRITICAL_SECTION_ENTER;
+    uint32_t fresh = events & ~g_events & ((1UL << EVENT_COUNT) - 1U);
+    for (uint8_t bit = 0; fresh != 0; bit++, fresh >>= 1) {
+        if (fresh & 1U) g_event_cycle[bit] = DWT->CYCCNT;
+    }
+    g_events |= events;
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+// ■ 이벤트 기다리기: 없으면 WFI 로 잠들고, 올라온 이벤트를 모두 가져감
+//   인터럽트를 막은 채로 확인 후 WFI > 확인과 잠들기 사이에 온 인터럽트도 WFI 를 깨움 (놓치지 않음)
+uint32_t event_wait() {
+    uint32_t events;
+
+    __disable_irq();
+    while (g_events == 0) {
+        uint32_t start = DWT->CYCCNT;
+        __WFI();
+        g_cpu_load.idle += DWT->CYCCNT - start; // 깨운 인터럽트는 아직 실행 전 (SysTick 집계와 겹치지 않음)
+        __enable_irq(); // 깨운 인터럽트 실행
+        __disable_irq();
+    }
+    events = g_events;
+    g_events = 0;
+    if (events & EVENT_UART_RX) {
+        uint32_t latency = DWT->CYCCNT - g_event_cycle[0]; // EVENT_UART_RX = 비트 0
+        if (latency > g_cpu_load.latency) g_cpu_load.latency = latency;
+    }
+    __enable_irq();
+    return events;
+}
 
-    // 타이머 설정 시 초기 시간 설정
-    g_new_minutes = minutes;  // 분으로 설정
-    g_new_seconds = 0;        // 초는 0으로 시작
+// ■ 소프트웨어 트리거 ADC 샘플 주기 (타이머 휠 콜백, 하드웨어 트리거는 블록 완성 때 adc_callback 이 올림)
+void adc_poll_tick(tw_timer_t *timer, void *arg) {
+    (void)timer; (void)arg;
+    if (!g_adc_hw_trigger) event_post(EVENT_ADC);
 }
 
-void write_time() {
-    if (g_uart_tick_output_flag) {
-        snprintf(g_tx_buffer, sizeof(g_tx_buffer), "\033[A\r\033[K%02d:%02d", g_new_minutes, g_new_seconds);
-        R_SCI_UART_Write(&g_uart0_ctrl, (uint8_t *)g_tx_buffer, strlen(g_tx_buffer));
-        g_uart_tick_output_flag = false;
+// ■ 주기 항목 표 시작 (주기 항목은 타이머 휠에 등록)
+void rt_init() {
+    uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+    for (uint8_t i = 0; i < RT_TASK_COUNT; i++) {
+        const rt_task_cfg_t *cfg = &g_rt_tasks[i];
+        rt_task_stat_t *st = &g_rt_stats[i];
+        memset(st, 0, sizeof(*st));
+        st->latency_min = UINT32_MAX;
+        st->deadline_cycles = cfg->period_ms * 1000U * cycles_per_us;
+        st->budget_cycles = cfg->budget_us * cycles_per_us;
+        tw_timer_init(&st->timer, rt_release_tick, st);
+        if (cfg->periodic) {
+            uint32_t period = cfg->period_ms * TICK_PER_ONE_SEC / 1000U;
+            tw_start(&g_timer_wheel, &st->timer, period, period);
+        }
     }
 }
 
+// ■ 항목 풀기 (cycle: 풀린 시점, 이미 풀려 있으면 이벤트만 모음)
+void rt_release(uint8_t index, uint32_t events, uint32_t cycle) {
+    rt_task_stat_t *st = &g_rt_stats[index];
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    FSP_CRITICAL_SECTION_ENTER;
+    if (!st->released) {
+        st->released = true;
+        st->release_cycle = cycle;
+    }
+    else if (events == 0) {
+        st->misses++;               // 주기 항목이 이전 주기를 아직 실행하지 못함 (한 번만 셈)
+        st->release_cycle = cycle;  // 실행은 새 주기 것으로 > 마감도 새 주기 기준
+    }
+    st->events |= events;
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+// ■ 주기 항목 풀기 (타이머 휠 콜백, 시스템 틱 인터럽트)
+void rt_release_tick(tw_timer_t *timer, void *arg) {
+    (void)timer;
+    rt_release((uint8_t)((rt_task_stat_t *)arg - g_rt_stats), 0, DWT->CYCCNT);
+    event_post(EVENT_RT);
+}
+
+// ■ 이벤트 항목 풀기 (event_wait 에서 가져온 이벤트, 풀린 시점 = 그 중 가장 먼저 올라온 이벤트)
+void rt_release_events(uint32_t events) {
+    for (uint8_t i = 0; i < RT_TASK_COUNT; i++) {
+        uint32_t hit = events & g_rt_tasks[i].events;
+        if (hit == 0) continue;
+
+        uint32_t now = DWT->CYCCNT, oldest = now;
+        for (uint8_t bit = 0; bit < EVENT_COUNT; bit++) {
+            if ((hit & (1UL << bit)) && (now - g_event_cycle[bit]) > (now - oldest)) oldest = g_event_cycle[bit];
+        }
+        rt_release(i, hit, oldest);
+    }
+}
+
+// ■ 풀린 항목 실행 (우선순위 순서, 하나 실행할 때마다 처음부터 다시 확인) + 실행 통계
+void rt_dispatch() {
+    uint8_t i = 0;
+    while (i < RT_TASK_COUNT) {
+        rt_task_stat_t *st = &g_rt_stats[i];
+        if (!st->released) {
+            i++;
+            continue;
+        }
+
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        uint32_t release = st->release_cycle;
+        uint32_t events = st->events;
+        st->events = 0;
+        st->released = false;
+        FSP_CRITICAL_SECTION_EXIT;
+
+        uint32_t start = DWT->CYCCNT;
+        g_rt_tasks[i].handler(events);
+        uint32_t end = DWT->CYCCNT;
+
+        uint32_t exec = end - start;
+        st->runs++;
+        st->exec_sum += exec;
+        if (exec > st->exec_max) st->exec_max = exec;
+        if (start - release < st->latency_min) st->latency_min = start - release;
+        if (start - release > st->latency_max) st->latency_max = start - release;
+        if (exec > st->budget_cycles) st->overruns++;
+        if (end - release > st->deadline_cycles) st->misses++;
+
+        i = 0;
+    }
+}
+
+// ■ [P0] 명령어 처리 (EVENT_UART_RX)
+void rt_command(uint32_t events) {
+    (void)events;
+    process_command();
+}
+
+// ■ [P1] 버튼 읽기 (BUTTON_POLL_MS 마다), 값은 button_task 가 사용
+void rt_buttons(uint32_t events) {
+    (void)events;
+    uint8_t pressed = 0;
+    if (button_pressed(BUTTON_S1)) pressed |= 1U << g_color_btn_task.num;
+    if (button_pressed(BUTTON_S2)) pressed |= 1U << g_brightness_btn_task.num;
+    g_buttons_pressed = pressed;
+    event_post(EVENT_BUTTON);
+}
+
+// ■ [P2] 조도센서 블록 처리 (EVENT_ADC)
+void rt_adc(uint32_t events) {
+    (void)events;
+    adc_read();
+}
+
+// ■ [P3] 태스크 디스패치 (모든 이벤트): ON/OFF 예약, 자동 조명 ON/OFF, 색상 변경 / 밝기 조절 버튼
+void rt_tasks(uint32_t events) {
+    task_dispatch(g_tasks, TASK_COUNT, events);
+}
+
 /* hal_entry()■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■■*/
 /*******************************************************************************************************************//**
  * main() is generated by the RA Configuration editor and is used to generate threads if an RTOS is used.  This function
@@ -863,25 +2171,19 @@ void hal_entry(void)
     /* TODO: add your own code here */
     Device_Init();
 
-    while (1) {
-        // (1) 데이터 읽기 : READ ADC data
-        int adc_avg = adc_read();
-
-        // (2) 자동 조명 ON/OFF : Auto Light On/Off
-        auto_on_off(adc_avg);
+    tasks_init();
+    rt_init();
+    tw_start(&g_timer_wheel, &g_adc_poll_timer, ADC_SW_POLL_MS * TICK_PER_ONE_SEC / 1000U, ADC_SW_POLL_MS * TICK_PER_ONE_SEC / 1000U);
 
-        // (3) 색상 변경 버튼 클릭?
-        check_btn_clicked(BUTTON_S1, g_color_btn_level, &g_color_btn_state);
-
-        // (4) 밝기 조절 버튼 클릭?
-        check_btn_clicked(BUTTON_S2, g_brightness_btn_level, &g_brightness_btn_state);
+    while (1) {
+        // (0) 이벤트 기다리기 (없으면 WFI 로 잠듦)
+        uint32_t events = event_wait();
 
-        // (5) Command 수신 확인? (밝기 조절 Command | 타이머 설정 Command )
-        process_command();
-        write_time();
+        // (1) 이벤트로 풀리는 항목 표시 (Command 수신, ADC 블록, 태스크)
+        rt_release_events(events);
 
-        // (6) DELAY
-        delay_ms(HAL_ENTRY_DELAY);
+        // (2) 풀린 항목을 우선순위 순서대로 실행 (g_rt_tasks)
+        rt_dispatch();
     }
 
 #if BSP_TZ_SECURE_BUILD
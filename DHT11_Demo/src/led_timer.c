@@ -0,0 +1,57 @@
+#include "led_timer.h"
+
+// ■ 초기화 (task_sched_init 뒤에, 태스크도 함께 시작)
+void led_timer_init(led_timer_task_t *lt, uint32_t set_event, uint32_t reset_event, uint32_t ticks_per_sec,
+                    void (*on_second)(uint32_t remaining), void (*on_expire)(void)) {
+    lt->set_event = set_event;
+    lt->reset_event = reset_event;
+    lt->ticks_per_sec = ticks_per_sec;
+    lt->on_second = on_second;
+    lt->on_expire = on_expire;
+    lt->minutes = 0;
+    lt->active = false;
+    lt->remaining = 0;
+    task_init(&lt->task, led_timer_task);
+}
+
+// ■ 새 예약 (이어서 set_event 를 올릴 것, 태스크가 받아서 시작)
+void led_timer_set(led_timer_task_t *lt, uint32_t minutes) {
+    lt->minutes = minutes;
+    lt->active = true;
+}
+
+// ■ 예약 불러오기 (지금 틱부터 1초씩)
+static inline void led_timer_load(led_timer_task_t *lt) {
+    lt->active = true;
+    lt->remaining = lt->minutes * 60U;
+    lt->deadline = task_now() + lt->ticks_per_sec;
+}
+
+// ■ ON/OFF 예약 태스크: 1초마다 남은 시간 출력, 0 이 되면 on_expire (새 예약이 오면 다시 시작, 취소면 끝)
+uint8_t led_timer_task(task_t *t) {
+    led_timer_task_t *lt = (led_timer_task_t *)t;
+
+    TASK_BEGIN(t);
+    while (1) {
+        TASK_AWAIT(t, lt->set_event);
+        led_timer_load(lt);
+
+        while (lt->remaining > 0) {
+            TASK_AWAIT_TIMEOUT(t, lt->set_event | lt->reset_event, task_ticks_until(lt->deadline));
+            if (t->events & lt->set_event) {
+                led_timer_load(lt);
+                continue;
+            }
+            if (t->events & lt->reset_event) break;
+
+            lt->deadline += lt->ticks_per_sec;
+            lt->remaining--;
+            lt->on_second(lt->remaining);
+        }
+        lt->active = false;
+
+        // 남은 시간이 0이 되었을 때 (취소가 아니면)
+        if (lt->remaining == 0) lt->on_expire();
+    }
+    TASK_END(t);
+}
@@ -0,0 +1,33 @@
+/***
+ LED ON/OFF 예약 카운트다운 태스크 (task.h)
+ - 예약 이벤트 (set_event) 가 오면 minutes 분부터 1초마다 on_second(남은 초), 0 이 되면 on_expire()
+ - 1초 경계는 예약 시각 + k 초로 고정 (마감 시각 기준 대기) > 디스패치가 늦어도 다음 초가 밀리지 않음
+ - 카운트다운 중 새 예약이 오면 처음부터, reset_event 면 취소 (on_expire 없음)
+ - 이벤트 비트 / 틱 주기 / 출력은 초기화 때 받음 (hal_entry.c 와 무관하게 호스트 테스트 가능)
+ ***/
+#ifndef LED_TIMER_H
+#define LED_TIMER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "task.h"
+
+typedef struct {
+    task_t task;                            // 첫 번째 멤버 (task_t * 로 디스패치)
+    uint32_t set_event;                     // 새 예약 이벤트 비트
+    uint32_t reset_event;                   // 예약 취소 이벤트 비트
+    uint32_t ticks_per_sec;                 // 1초 틱 수
+    void (*on_second)(uint32_t remaining);  // 1초마다 (남은 초)
+    void (*on_expire)(void);                // 0 이 됨
+    uint32_t minutes;                       // 새 예약 시간 (led_timer_set > 태스크)
+    volatile _Bool active;                  // 예약 중
+    uint32_t remaining;                     // 남은 시간 (초)
+    uint32_t deadline;                      // 다음 1초가 끝나는 틱 (누적 오차 없이 1초씩)
+} led_timer_task_t;
+
+void led_timer_init(led_timer_task_t *lt, uint32_t set_event, uint32_t reset_event, uint32_t ticks_per_sec,
+                    void (*on_second)(uint32_t remaining), void (*on_expire)(void));
+void led_timer_set(led_timer_task_t *lt, uint32_t minutes);
+uint8_t led_timer_task(task_t *t);
+
+#endif /* LED_TIMER_H */
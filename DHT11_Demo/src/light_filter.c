@@ -0,0 +1,30 @@
+#include "light_filter.h"
+
+const q31_t g_light_biquad_coeffs[5 * LIGHT_FILTER_BIQUAD_STAGES] = { LIGHT_FILTER_BIQUAD_COEFFS };
+
+// ■ 조도센서 필터 초기화 (상태는 0 으로)
+void light_filter_init(light_filter_t *lf) {
+    for (uint16_t i = 0; i < LIGHT_FILTER_FIR_TAPS; i++) lf->fir_coeffs[i] = LIGHT_FILTER_FIR_COEFF;
+    q31_biquad_init(&lf->biquad, LIGHT_FILTER_BIQUAD_STAGES, g_light_biquad_coeffs, lf->biquad_state,
+                    LIGHT_FILTER_POST_SHIFT);
+    q31_fir_decimate_init(&lf->fir, LIGHT_FILTER_FIR_TAPS, LIGHT_FILTER_DECIMATION, lf->fir_coeffs,
+                          lf->fir_state, ADC_BLOCK_SIZE);
+    lf->out = 0;
+}
+
+// ■ 블록 하나 필터링 (scale_log2: 오버샘플링 덧셈 횟수의 log2, 반환값: 12비트 기준 필터 출력)
+uint16_t light_filter_process(light_filter_t *lf, const uint16_t *block, uint8_t scale_log2) {
+    // ADC 값 > Q31 (16회 덧셈 모드는 4비트 덜 올림)
+    uint32_t shift = LIGHT_FILTER_Q31_SHIFT - scale_log2;
+    for (uint16_t i = 0; i < ADC_BLOCK_SIZE; i++) {
+        lf->buf[i] = (q31_t)((uint32_t)block[i] << shift);
+    }
+
+    q31_biquad_process(&lf->biquad, lf->buf, lf->buf, ADC_BLOCK_SIZE);
+    q31_fir_decimate_process(&lf->fir, lf->buf, &lf->out, ADC_BLOCK_SIZE);
+
+    // Q31 > 12비트 (반올림, 필터 과도응답으로 범위를 넘으면 자르기)
+    if (lf->out <= 0) return 0;
+    uint32_t value = ((uint32_t)lf->out + (1U << (LIGHT_FILTER_Q31_SHIFT - 1))) >> LIGHT_FILTER_Q31_SHIFT;
+    return (uint16_t)((value > LIGHT_FILTER_OUT_MAX) ? LIGHT_FILTER_OUT_MAX : value);
+}
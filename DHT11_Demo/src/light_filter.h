@@ -0,0 +1,35 @@
+/***
+ 조도센서 필터 (노치 + 저역통과 + 데시메이션, q31_filter.h)
+ 블록(64개, 640Hz) > 120Hz 노치 (조명 깜빡임) > 5Hz 저역통과 > 평균 FIR 로 1개 (100ms 마다)
+ 계수는 tools/filter_coeffs.py 로 생성 (light_filter_coeffs.h)
+ - ADC 값 (12비트 x 오버샘플링) 을 Q31 로 올릴 때 2비트 여유: 최대 4095 << 17 < 2^29
+   (노치 / 저역통과의 과도응답 오버슈트로 Q31 을 넘어가면 MACL / CMSIS 는 부호가 바뀜)
+ - 출력은 12비트 기준으로 반올림, 범위 밖 (과도응답) 은 0 ~ 4095 로 자름
+ ***/
+#ifndef LIGHT_FILTER_H
+#define LIGHT_FILTER_H
+
+#include <stdint.h>
+#include "q31_filter.h"
+#include "light_filter_coeffs.h"
+#include "adc_block.h"
+
+#define LIGHT_FILTER_Q31_SHIFT 17   // 12비트 값 > Q31 (2비트 여유)
+#define LIGHT_FILTER_OUT_MAX 4095   // 출력 최댓값 (12비트)
+
+typedef struct {
+    q31_biquad_t biquad;
+    q31_fir_decimate_t fir;
+    q31_t biquad_state[4 * LIGHT_FILTER_BIQUAD_STAGES];
+    q31_t fir_coeffs[LIGHT_FILTER_FIR_TAPS];
+    q31_t fir_state[LIGHT_FILTER_FIR_TAPS + ADC_BLOCK_SIZE - 1];
+    q31_t buf[ADC_BLOCK_SIZE];
+    q31_t out;                      // 마지막 필터 출력 (Q31, 12비트로 바꾸기 전)
+} light_filter_t;
+
+extern const q31_t g_light_biquad_coeffs[5 * LIGHT_FILTER_BIQUAD_STAGES];
+
+void light_filter_init(light_filter_t *lf);
+uint16_t light_filter_process(light_filter_t *lf, const uint16_t *block, uint8_t scale_log2);
+
+#endif /* LIGHT_FILTER_H */
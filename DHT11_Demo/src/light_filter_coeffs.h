@@ -0,0 +1,20 @@
+/* tools/filter_coeffs.py 로 생성 (직접 수정하지 말 것) */
+/* fs 640Hz, 노치 120Hz Q2.0, 저역통과 5Hz 버터워스 */
+#ifndef LIGHT_FILTER_COEFFS_H
+#define LIGHT_FILTER_COEFFS_H
+
+#define LIGHT_FILTER_FS_HZ 640
+#define LIGHT_FILTER_BIQUAD_STAGES 2
+#define LIGHT_FILTER_POST_SHIFT 1
+#define LIGHT_FILTER_FIR_TAPS 64
+#define LIGHT_FILTER_DECIMATION 64
+
+// 스테이지당 {b0, b1, b2, a1, a2} (Q31, / 2^post_shift)
+#define LIGHT_FILTER_BIQUAD_COEFFS \
+    872273025, -667608871, 872273025, 667608871, -670804227 /* 노치 120Hz Q2.0 */, \
+    624999, 1249999, 624999, 2072972867, -1001731041 /* 저역통과 5Hz 버터워스 */
+
+// 평균 필터 (계수 1/64)
+#define LIGHT_FILTER_FIR_COEFF 33554432
+
+#endif /* LIGHT_FILTER_COEFFS_H */
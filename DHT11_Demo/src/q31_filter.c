@@ -0,0 +1,108 @@
+#include "q31_filter.h"
+#include <string.h>
+
+// ■ biquad 초기화 (상태는 0 으로)
+void q31_biquad_init(q31_biquad_t *f, uint8_t num_stages, const q31_t *coeffs, q31_t *state, int8_t post_shift) {
+    memset(state, 0, sizeof(q31_t) * 4U * num_stages);
+#if Q31_FILTER_USE_MACL
+    f->inst.numStages = num_stages;
+    f->inst.pCoeffs = (q31_t *) coeffs;
+    f->inst.pState = state;
+    f->inst.postShift = post_shift;
+#else
+    f->num_stages = num_stages;
+    f->coeffs = coeffs;
+    f->state = state;
+    f->post_shift = post_shift;
+#endif
+}
+
+// ■ Q31 포화 (64비트 > 32비트)
+static inline q31_t q31_sat(int64_t value) {
+    if (value > INT32_MAX) return INT32_MAX;
+    if (value < INT32_MIN) return INT32_MIN;
+    return (q31_t)value;
+}
+
+// ■ biquad 직렬 연결 C 코드 (Direct Form I, CMSIS 와 같이 내림, 출력은 포화)
+void q31_biquad_df1_c(const q31_t *coeffs, q31_t *state, uint8_t num_stages, int8_t post_shift,
+                      const q31_t *src, q31_t *dst, uint32_t block_size) {
+    uint32_t shift = (uint32_t)(31 - post_shift);
+
+    for (uint8_t stage = 0; stage < num_stages; stage++) {
+        q31_t b0 = coeffs[0], b1 = coeffs[1], b2 = coeffs[2], a1 = coeffs[3], a2 = coeffs[4];
+        q31_t x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+
+        for (uint32_t n = 0; n < block_size; n++) {
+            q31_t x0 = src[n];
+            int64_t acc = (int64_t)b0 * x0 + (int64_t)b1 * x1 + (int64_t)b2 * x2
+                        + (int64_t)a1 * y1 + (int64_t)a2 * y2;
+            q31_t y0 = q31_sat(acc >> shift); // 넘어가면 부호가 바뀌어 필터가 발산하므로 포화
+
+            x2 = x1; x1 = x0;
+            y2 = y1; y1 = y0;
+            dst[n] = y0;
+        }
+
+        state[0] = x1; state[1] = x2; state[2] = y1; state[3] = y2;
+        coeffs += 5;
+        state += 4;
+        src = dst; // 다음 스테이지는 이전 스테이지 출력을 입력으로
+    }
+}
+
+// ■ biquad 직렬 연결 (Direct Form I), src 와 dst 는 같은 버퍼여도 됨
+void q31_biquad_process(q31_biquad_t *f, const q31_t *src, q31_t *dst, uint32_t block_size) {
+#if Q31_FILTER_USE_MACL
+    R_BSP_MaclBiquadCsdDf1Q31(&f->inst, src, dst, block_size);
+#else
+    q31_biquad_df1_c(f->coeffs, f->state, f->num_stages, f->post_shift, src, dst, block_size);
+#endif
+}
+
+// ■ FIR 데시메이션 초기화 (block_size 는 factor 의 배수)
+void q31_fir_decimate_init(q31_fir_decimate_t *f, uint16_t num_taps, uint8_t factor, const q31_t *coeffs, q31_t *state,
+                           uint32_t block_size) {
+    memset(state, 0, sizeof(q31_t) * (num_taps + block_size - 1U));
+#if Q31_FILTER_USE_MACL
+    f->inst.M = factor;
+    f->inst.numTaps = num_taps;
+    f->inst.pCoeffs = (q31_t *) coeffs;
+    f->inst.pState = state;
+#else
+    f->factor = factor;
+    f->num_taps = num_taps;
+    f->coeffs = coeffs;
+    f->state = state;
+#endif
+}
+
+// ■ FIR 데시메이션 C 코드: 입력 block_size 개 > 출력 block_size / factor 개
+void q31_fir_decimate_c(const q31_t *coeffs, q31_t *state, uint16_t num_taps, uint8_t factor,
+                        const q31_t *src, q31_t *dst, uint32_t block_size) {
+    uint32_t history = num_taps - 1U;
+
+    // 상태 = [이전 블록의 마지막 (탭 수 - 1) 개][이번 블록]
+    memcpy(&state[history], src, sizeof(q31_t) * block_size);
+
+    for (uint32_t out = 0; out < block_size / factor; out++) {
+        const q31_t *x = &state[out * factor];
+        int64_t acc = 0;
+        for (uint16_t k = 0; k < num_taps; k++) {
+            acc += (int64_t)coeffs[k] * x[k];
+        }
+        dst[out] = q31_sat(acc >> 31);
+    }
+
+    // 다음 블록을 위해 마지막 (탭 수 - 1) 개를 앞으로
+    memmove(state, &state[block_size], sizeof(q31_t) * history);
+}
+
+// ■ FIR 데시메이션: 입력 block_size 개 > 출력 block_size / factor 개
+void q31_fir_decimate_process(q31_fir_decimate_t *f, const q31_t *src, q31_t *dst, uint32_t block_size) {
+#if Q31_FILTER_USE_MACL
+    R_BSP_MaclFirDecimateQ31(&f->inst, src, dst, block_size);
+#else
+    q31_fir_decimate_c(f->coeffs, f->state, f->num_taps, f->factor, src, dst, block_size);
+#endif
+}
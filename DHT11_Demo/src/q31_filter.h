@@ -0,0 +1,64 @@
+/***
+ Q31 고정소수점 필터 (biquad 직렬 연결, FIR 데시메이션)
+ - MACL 이 있는 MCU (BSP_FEATURE_MACL_SUPPORTED + CMSIS-DSP 헤더) 에서는 BSP MACL 함수 사용
+   (R_BSP_MaclBiquadCsdDf1Q31, R_BSP_MaclFirDecimateQ31)
+ - 없으면 (RA4M2 등) 같은 계산을 하는 C 코드 사용 > PC 에서도 그대로 컴파일 가능
+   C 코드는 MACL 이 있어도 q31_biquad_df1_c / q31_fir_decimate_c 로 호출 가능 (처리 시간 비교용)
+ - C 코드는 출력이 Q31 범위를 넘으면 포화 (CMSIS / MACL 은 넘어감 > 입력에 여유 비트를 두고 사용)
+ - 계수/상태 형식은 CMSIS-DSP 와 같음
+   biquad: 스테이지당 계수 {b0, b1, b2, a1, a2}, 상태 {x[n-1], x[n-2], y[n-1], y[n-2]}
+   FIR   : 계수는 시간 역순, 상태 크기 = 탭 수 + 블록 크기 - 1
+ ***/
+#ifndef Q31_FILTER_H
+#define Q31_FILTER_H
+
+#include <stdint.h>
+
+#ifdef Q31_FILTER_HOST
+ #define Q31_FILTER_USE_MACL 0
+#else
+ #include "bsp_api.h"
+ #if BSP_FEATURE_MACL_SUPPORTED && __has_include("arm_math_types.h")
+  #define Q31_FILTER_USE_MACL 1
+ #else
+  #define Q31_FILTER_USE_MACL 0
+ #endif
+#endif
+
+#if !Q31_FILTER_USE_MACL
+typedef int32_t q31_t;
+#endif
+
+typedef struct {
+#if Q31_FILTER_USE_MACL
+    arm_biquad_casd_df1_inst_q31 inst;
+#else
+    uint8_t num_stages;
+    int8_t post_shift;      // 계수 = 실제값 / 2^post_shift
+    const q31_t *coeffs;    // 5 x num_stages
+    q31_t *state;           // 4 x num_stages
+#endif
+} q31_biquad_t;
+
+typedef struct {
+#if Q31_FILTER_USE_MACL
+    arm_fir_decimate_instance_q31 inst;
+#else
+    uint8_t factor;         // 데시메이션 비율 (M)
+    uint16_t num_taps;
+    const q31_t *coeffs;    // num_taps 개 (시간 역순)
+    q31_t *state;           // num_taps + 블록 크기 - 1
+#endif
+} q31_fir_decimate_t;
+
+void q31_biquad_df1_c(const q31_t *coeffs, q31_t *state, uint8_t num_stages, int8_t post_shift,
+                      const q31_t *src, q31_t *dst, uint32_t block_size);
+void q31_fir_decimate_c(const q31_t *coeffs, q31_t *state, uint16_t num_taps, uint8_t factor,
+                        const q31_t *src, q31_t *dst, uint32_t block_size);
+void q31_biquad_init(q31_biquad_t *f, uint8_t num_stages, const q31_t *coeffs, q31_t *state, int8_t post_shift);
+void q31_biquad_process(q31_biquad_t *f, const q31_t *src, q31_t *dst, uint32_t block_size);
+void q31_fir_decimate_init(q31_fir_decimate_t *f, uint16_t num_taps, uint8_t factor, const q31_t *coeffs, q31_t *state,
+                           uint32_t block_size);
+void q31_fir_decimate_process(q31_fir_decimate_t *f, const q31_t *src, q31_t *dst, uint32_t block_size);
+
+#endif /* Q31_FILTER_H */
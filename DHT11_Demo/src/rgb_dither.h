@@ -0,0 +1,30 @@
+/***
+ RGB LED 디더링 (1차 시그마-델타, 채널 하나)
+ - 듀티는 내부적으로 카운트의 1/2^RGB_DITHER_BITS 단위(fine) 로 관리
+ - PWM 주기마다 rgb_dither_next() 로 base / base+1 카운트 중 하나를 골라서, 평균 듀티가 fine 값이 되도록
+   누적 오차가 1 카운트를 넘으면 이번 주기만 base + 1 > N 주기 평균 = fine 값 (오차 1/N 카운트 이하)
+ - 하드웨어와 무관 (비교값 쓰기는 hal_entry.c), 호스트 테스트에서 그대로 시뮬레이션
+ ***/
+#ifndef RGB_DITHER_H
+#define RGB_DITHER_H
+
+#include <stdint.h>
+
+#define RGB_DITHER_BITS 6
+#define RGB_DITHER_MASK ((1U << RGB_DITHER_BITS) - 1U)
+#define RGB_FINE(counts) ((uint32_t)(counts) << RGB_DITHER_BITS)                          // 카운트 > fine
+#define RGB_FINE_ROUND(fine) (((fine) + (1U << (RGB_DITHER_BITS - 1))) >> RGB_DITHER_BITS) // fine > 카운트 (반올림)
+#define RGB_FINE_CEIL(fine) (((fine) + RGB_DITHER_MASK) >> RGB_DITHER_BITS)                // fine > 카운트 (올림, 0 이 아니면 1 이상)
+
+// ■ 한 주기 출력 카운트 (acc: 채널의 누적 오차, 0 으로 시작)
+static inline uint32_t rgb_dither_next(uint32_t *acc, uint32_t fine) {
+    uint32_t counts = fine >> RGB_DITHER_BITS;
+    *acc += fine & RGB_DITHER_MASK;
+    if (*acc > RGB_DITHER_MASK) {
+        *acc -= RGB_FINE(1);
+        counts++;
+    }
+    return counts;
+}
+
+#endif /* RGB_DITHER_H */
@@ -0,0 +1,63 @@
+#include "rgb_sync.h"
+
+#ifdef RGB_SYNC_HOST
+ #define RGB_SYNC_READ(reg) rgb_sync_host_read(&(reg))
+ #define RGB_SYNC_WRITE(reg, value) rgb_sync_host_write(&(reg), (value))
+#else
+ #define RGB_SYNC_READ(reg) (reg)
+ #define RGB_SYNC_WRITE(reg, value) ((reg) = (value))
+#endif
+
+// ■ 초기화 (타이머를 연 뒤에, 레지스터 주소만 보관)
+void rgb_sync_init(rgb_sync_t *s, R_GPT0_Type *r, R_GPT0_Type *g, R_GPT0_Type *b,
+                   uint32_t period, uint32_t write_limit, uint32_t guard) {
+    s->p_reg[0] = r;
+    s->p_reg[1] = g;
+    s->p_reg[2] = b;
+    s->period = period;
+    s->write_limit = write_limit;
+    s->guard = guard;
+}
+
+// ■ 카운터가 limit 이하가 될 때까지 대기 (넘었으면 다음 주기 시작까지, 최대 한 주기)
+static void rgb_sync_wait(const rgb_sync_t *s, uint32_t limit) {
+    while (RGB_SYNC_READ(s->p_reg[0]->GTCNT) > limit) {
+        ;
+    }
+}
+
+// ■ 세 채널의 GTCCR 버퍼 전송 금지 / 허용 (GTBER.BD0)
+static void rgb_sync_hold(const rgb_sync_t *s, _Bool hold) {
+    for (uint8_t ch = 0; ch < 3; ch++) {
+        uint32_t gtber = RGB_SYNC_READ(s->p_reg[ch]->GTBER);
+        if (hold) gtber |= R_GPT0_GTBER_BD0_Msk;
+        else gtber &= ~(uint32_t)R_GPT0_GTBER_BD0_Msk;
+        RGB_SYNC_WRITE(s->p_reg[ch]->GTBER, gtber);
+    }
+}
+
+// ■ 한 채널의 비교값을 버퍼에 쓰기 (다음 주기 끝에 반영)
+void rgb_sync_compare(const rgb_sync_t *s, uint8_t ch, uint32_t counts) {
+    R_GPT0_Type * const p_reg = s->p_reg[ch];
+    uint32_t gtuddtyc = RGB_SYNC_READ(p_reg->GTUDDTYC) & ~(uint32_t)R_GPT0_GTUDDTYC_OADTY_Msk;
+    if (counts == 0 || counts >= s->period) {
+        uint32_t gtioa = (RGB_SYNC_READ(p_reg->GTIOR) & R_GPT0_GTIOR_GTIOA_Msk) >> R_GPT0_GTIOR_GTIOA_Pos;
+        _Bool first_level_low = (gtioa & 0xCU) == 0x4U; // 주기 끝 출력 설정
+        _Bool zero = (counts == 0);
+        uint32_t oadty = (zero != first_level_low) ? RGB_SYNC_OADTY_0_PERCENT : RGB_SYNC_OADTY_100_PERCENT;
+        gtuddtyc |= oadty << R_GPT0_GTUDDTYC_OADTY_Pos;
+    }
+    else {
+        RGB_SYNC_WRITE(p_reg->GTCCR[2], counts - 1U);
+    }
+    RGB_SYNC_WRITE(p_reg->GTUDDTYC, gtuddtyc);
+}
+
+// ■ R/G/B 비교값을 같은 주기 끝에 함께 반영 (인터럽트 금지 상태에서 호출)
+void rgb_sync_write(const rgb_sync_t *s, const uint32_t counts[3]) {
+    rgb_sync_hold(s, true);                             // (1)
+    rgb_sync_wait(s, s->write_limit);                   // (2)
+    for (uint8_t ch = 0; ch < 3; ch++) rgb_sync_compare(s, ch, counts[ch]);
+    rgb_sync_wait(s, s->period - s->guard);             // (3)
+    rgb_sync_hold(s, false);
+}
@@ -0,0 +1,46 @@
+/***
+ RGB PWM 세 채널 동시 변경 (GPT 레지스터 순서만, 호스트 테스트 가능)
+ - 세 타이머 (R/G/B) 는 같은 클럭/주기로 동시에 시작 > 카운터가 항상 같으므로 R 타이머 카운터만 봄
+ - 비교값은 버퍼(GTCCRC) 에 쓰고, 주기 끝에 GTCCRA 로 전송되어 출력에 반영
+   채널마다 따로 쓰면 쓰는 도중에 주기 끝이 지나갈 때 한 주기 동안 섞인 색(예: R 만 바뀐 색)이 보임
+ - rgb_sync_write(): 세 채널이 같은 주기 끝에서 함께 바뀌도록
+   (1) 세 채널의 버퍼 전송 금지 (GTBER.BD0: GTCCR 버퍼, BD1 은 GTPR 주기 버퍼라서 아님)
+   (2) 카운터가 write_limit 이하일 때 (주기 앞부분) 세 채널 쓰기
+       0%/100% 출력 설정 GTUDDTYC.OADTY 는 BD0 와 상관없이 주기 끝에 반영되므로 세 채널을 같은 주기 안에 씀
+   (3) 주기 끝까지 guard 카운트 이상 남았을 때 전송 허용 > 다음 주기 끝에서 세 채널이 함께 바뀜
+   인터럽트 금지는 부르는 쪽에서 (최대 한 주기 반 정도)
+ - rgb_sync_compare(): 한 채널 비교값을 버퍼에 바로 쓰기 (r_gpt.c gpt_calculate_duty_cycle() 과 같은 규칙,
+   0 / 주기 는 OADTY 로, 나머지는 GTCCRC = 카운트 - 1), 디더링처럼 주기 시작 직후에 쓰는 경우는 이것만
+ - RGB_SYNC_HOST 를 정의하면 레지스터 읽기/쓰기가 rgb_sync_host_read() / rgb_sync_host_write() 호출로 바뀜
+   > PC 에서 카운터와 주기 끝 전송을 흉내 내는 모델로 검사 (test/test_set_rgb.c)
+ ***/
+#ifndef RGB_SYNC_H
+#define RGB_SYNC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bsp_api.h"
+
+// 0% / 100% 출력 설정 GTUDDTYC.OADTY (r_gpt.c gpt_duty_cycle_mode_t 와 같은 값)
+#define RGB_SYNC_OADTY_0_PERCENT 2U
+#define RGB_SYNC_OADTY_100_PERCENT 3U
+
+typedef struct {
+    R_GPT0_Type *p_reg[3];  // R, G, B 타이머 레지스터 (카운터는 p_reg[0])
+    uint32_t period;        // PWM 주기 (카운트)
+    uint32_t write_limit;   // (2) 비교값 쓰기는 카운터가 이 값 이하일 때 시작
+    uint32_t guard;         // (3) 주기 끝까지 이만큼도 안 남았으면 다음 주기에 전송 허용
+} rgb_sync_t;
+
+void rgb_sync_init(rgb_sync_t *s, R_GPT0_Type *r, R_GPT0_Type *g, R_GPT0_Type *b,
+                   uint32_t period, uint32_t write_limit, uint32_t guard);
+void rgb_sync_compare(const rgb_sync_t *s, uint8_t ch, uint32_t counts);
+void rgb_sync_write(const rgb_sync_t *s, const uint32_t counts[3]);
+
+#ifdef RGB_SYNC_HOST
+// 호스트 테스트가 구현 (레지스터 접근 = 모델 시간 진행)
+uint32_t rgb_sync_host_read(volatile uint32_t *reg);
+void rgb_sync_host_write(volatile uint32_t *reg, uint32_t value);
+#endif
+
+#endif /* RGB_SYNC_H */
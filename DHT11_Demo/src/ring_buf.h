@@ -0,0 +1,169 @@
+/***
+ 범용 링버퍼 (통계 포함)
+ - 크기는 컴파일 타임에 2의 거듭제곱으로 고정 (인덱스는 % 대신 & MASK)
+ - 원소 타입은 자유 (정수 타입, 분산 계산은 16비트 이하 원소 기준)
+ - 통계는 필요한 만큼만 고름
+   RING_BUF_DEFINE_MEAN: push 할 때 합계만 갱신 > 평균 O(1), 최솟값/최댓값/분산은 name_scan() 으로 조회할 때 O(N)
+                         (평균만 자주 보고, 나머지는 가끔 명령어로 확인하는 경우)
+   RING_BUF_DEFINE     : push 할 때마다 합계 / 제곱합 / 최솟값 / 최댓값을 갱신 > 평균, 분산, 범위를 O(1) 로 조회
+                         최솟값/최댓값은 단조 덱(monotonic deque) 으로 관리 (push 1번당 평균 O(1), 대신 push 가 느림)
+ - 인터럽트에서 쓰는 버퍼가 아님 (한 곳에서만 push / 조회)
+
+ 사용 예)
+   RING_BUF_DEFINE(adc_avg_buf, uint16_t, 3)   // adc_avg_buf_t, 원소 8개
+   adc_avg_buf_t g_buf;
+   adc_avg_buf_init(&g_buf);
+   adc_avg_buf_push(&g_buf, 1234);
+   uint16_t mean = adc_avg_buf_mean(&g_buf);
+
+   RING_BUF_DEFINE_MEAN(adc_avg_buf, uint16_t, 3) // 같은 사용법, 평균만 O(1)
+   uint16_t min, max; uint32_t variance;
+   adc_avg_buf_scan(&g_buf, &min, &max, &variance);
+ ***/
+#ifndef RING_BUF_H
+#define RING_BUF_H
+
+#include <stdint.h>
+#include <string.h>
+
+// name: 타입/함수 이름 앞부분, type: 원소 타입, size_log2: 크기 = 2^size_log2
+// 평균만 유지 (최솟값/최댓값/분산은 name_scan 으로 버퍼 전체를 훑어서 계산)
+#define RING_BUF_DEFINE_MEAN(name, type, size_log2)                                                 \
+    enum { name##_SIZE = 1U << (size_log2), name##_MASK = (1U << (size_log2)) - 1U };               \
+                                                                                                    \
+    typedef struct {                                                                                \
+        type buffer[1U << (size_log2)];                                                             \
+        uint32_t seq;       /* 지금까지 push 한 개수 (증가만 함, 다음 위치 = seq & MASK) */         \
+        uint32_t count;     /* 버퍼에 있는 원소 수 (최대 SIZE) */                                    \
+        int64_t sum;        /* 합계 */                                                              \
+    } name##_t;                                                                                     \
+                                                                                                    \
+    static inline void name##_init(name##_t *rb) {                                                  \
+        memset(rb, 0, sizeof(*rb));                                                                 \
+    }                                                                                               \
+                                                                                                    \
+    static inline void name##_push(name##_t *rb, type data) {                                       \
+        type *slot = &rb->buffer[rb->seq & name##_MASK];                                            \
+        if (rb->count == name##_SIZE) rb->sum -= (int64_t)*slot; /* 가장 오래된 원소 빼기 */        \
+        else rb->count++;                                                                           \
+        *slot = data;                                                                               \
+        rb->sum += (int64_t)data;                                                                   \
+        rb->seq++;                                                                                  \
+    }                                                                                               \
+                                                                                                    \
+    /* 평균 (반올림, 비어 있으면 0) */                                                              \
+    static inline type name##_mean(const name##_t *rb) {                                            \
+        if (rb->count == 0) return (type)0;                                                         \
+        int64_t n = (int64_t)rb->count;                                                             \
+        int64_t half = (rb->sum >= 0) ? n / 2 : -(n / 2);                                           \
+        return (type)((rb->sum + half) / n);                                                        \
+    }                                                                                               \
+                                                                                                    \
+    /* 최솟값 / 최댓값 / 분산 (모분산, 정수 내림): 버퍼 전체를 훑음 O(N), 비어 있으면 모두 0 */       \
+    static inline void name##_scan(const name##_t *rb, type *min, type *max, uint32_t *variance) {  \
+        *min = (type)0;                                                                             \
+        *max = (type)0;                                                                             \
+        *variance = 0;                                                                              \
+        if (rb->count == 0) return;                                                                 \
+        uint64_t sum_sq = 0;                                                                        \
+        *min = *max = rb->buffer[(rb->seq - rb->count) & name##_MASK];                              \
+        for (uint32_t i = rb->seq - rb->count; i != rb->seq; i++) {                                 \
+            type v = rb->buffer[i & name##_MASK];                                                   \
+            sum_sq += (uint64_t)((int64_t)v * (int64_t)v);                                          \
+            if (v < *min) *min = v;                                                                 \
+            if (v > *max) *max = v;                                                                 \
+        }                                                                                           \
+        uint64_t n = rb->count;                                                                     \
+        uint64_t sum_abs = (uint64_t)((rb->sum >= 0) ? rb->sum : -rb->sum);                         \
+        *variance = (uint32_t)((n * sum_sq - sum_abs * sum_abs) / (n * n));                         \
+    }                                                                                               \
+                                                                                                    \
+    static inline uint32_t name##_count(const name##_t *rb) {                                       \
+        return rb->count;                                                                           \
+    }
+
+// 평균 + 분산 + 최솟값 + 최댓값을 push 할 때마다 갱신 (조회 O(1))
+#define RING_BUF_DEFINE(name, type, size_log2)                                                      \
+    enum { name##_SIZE = 1U << (size_log2), name##_MASK = (1U << (size_log2)) - 1U };               \
+                                                                                                    \
+    typedef struct {                                                                                \
+        type buffer[1U << (size_log2)];                                                             \
+        uint32_t seq;       /* 지금까지 push 한 개수 (증가만 함, 다음 위치 = seq & MASK) */         \
+        uint32_t count;     /* 버퍼에 있는 원소 수 (최대 SIZE) */                                    \
+        int64_t sum;        /* 합계 */                                                              \
+        uint64_t sum_sq;    /* 제곱합 */                                                            \
+        /* 단조 덱: 원소의 seq 를 저장 (min: 값이 증가하는 순서, max: 값이 감소하는 순서) */           \
+        uint32_t min_q[1U << (size_log2)];                                                          \
+        uint32_t max_q[1U << (size_log2)];                                                          \
+        uint32_t min_head, min_tail;                                                                \
+        uint32_t max_head, max_tail;                                                                \
+    } name##_t;                                                                                     \
+                                                                                                    \
+    static inline void name##_init(name##_t *rb) {                                                  \
+        memset(rb, 0, sizeof(*rb));                                                                 \
+    }                                                                                               \
+                                                                                                    \
+    static inline void name##_push(name##_t *rb, type data) {                                       \
+        uint32_t seq = rb->seq;                                                                     \
+        type *slot = &rb->buffer[seq & name##_MASK];                                                \
+                                                                                                    \
+        /* 가득 차면 가장 오래된 원소를 합계에서 빼고, 덱 앞에서도 제거 */                           \
+        if (rb->count == name##_SIZE) {                                                             \
+            int64_t old = (int64_t)*slot;                                                           \
+            rb->sum -= old;                                                                         \
+            rb->sum_sq -= (uint64_t)(old * old);                                                    \
+            uint32_t expired = seq - name##_SIZE;                                                   \
+            if (rb->min_q[rb->min_head & name##_MASK] == expired) rb->min_head++;                   \
+            if (rb->max_q[rb->max_head & name##_MASK] == expired) rb->max_head++;                   \
+        } else {                                                                                    \
+            rb->count++;                                                                            \
+        }                                                                                           \
+                                                                                                    \
+        *slot = data;                                                                               \
+        rb->sum += (int64_t)data;                                                                   \
+        rb->sum_sq += (uint64_t)((int64_t)data * (int64_t)data);                                    \
+                                                                                                    \
+        /* 덱 뒤에서 새 값보다 크거나 같은(min) / 작거나 같은(max) 원소 제거 후 추가 */               \
+        while (rb->min_tail != rb->min_head &&                                                      \
+               rb->buffer[rb->min_q[(rb->min_tail - 1U) & name##_MASK] & name##_MASK] >= data) {    \
+            rb->min_tail--;                                                                         \
+        }                                                                                           \
+        rb->min_q[rb->min_tail++ & name##_MASK] = seq;                                              \
+        while (rb->max_tail != rb->max_head &&                                                      \
+               rb->buffer[rb->max_q[(rb->max_tail - 1U) & name##_MASK] & name##_MASK] <= data) {    \
+            rb->max_tail--;                                                                         \
+        }                                                                                           \
+        rb->max_q[rb->max_tail++ & name##_MASK] = seq;                                              \
+                                                                                                    \
+        rb->seq = seq + 1U;                                                                         \
+    }                                                                                               \
+                                                                                                    \
+    /* 평균 (반올림, 비어 있으면 0) */                                                              \
+    static inline type name##_mean(const name##_t *rb) {                                            \
+        if (rb->count == 0) return (type)0;                                                         \
+        int64_t n = (int64_t)rb->count;                                                             \
+        int64_t half = (rb->sum >= 0) ? n / 2 : -(n / 2);                                           \
+        return (type)((rb->sum + half) / n);                                                        \
+    }                                                                                               \
+                                                                                                    \
+    /* 분산 (모분산, 정수 내림) = (n*제곱합 - 합계^2) / n^2 */                                       \
+    static inline uint32_t name##_variance(const name##_t *rb) {                                    \
+        if (rb->count == 0) return 0;                                                               \
+        uint64_t n = rb->count;                                                                     \
+        uint64_t sum_abs = (uint64_t)((rb->sum >= 0) ? rb->sum : -rb->sum);                         \
+        return (uint32_t)((n * rb->sum_sq - sum_abs * sum_abs) / (n * n));                          \
+    }                                                                                               \
+                                                                                                    \
+    static inline type name##_min(const name##_t *rb) {                                             \
+        return (rb->count == 0) ? (type)0 : rb->buffer[rb->min_q[rb->min_head & name##_MASK] & name##_MASK]; \
+    }                                                                                               \
+                                                                                                    \
+    static inline type name##_max(const name##_t *rb) {                                             \
+        return (rb->count == 0) ? (type)0 : rb->buffer[rb->max_q[rb->max_head & name##_MASK] & name##_MASK]; \
+    }                                                                                               \
+                                                                                                    \
+    static inline uint32_t name##_count(const name##_t *rb) {                                       \
+        return rb->count;                                                                           \
+    }
+
+#endif /* RING_BUF_H */
@@ -0,0 +1,77 @@
+#include "task.h"
+
+static timer_wheel_t *s_wheel;            // 타임아웃에 쓸 타이머 휠
+static void (*s_post)(uint32_t events);   // 메인 루프 깨우기 (event_post)
+static uint32_t s_wake_event;             // 타임아웃 / 양보 때 올릴 이벤트 비트
+
+// ■ 타임아웃 (타이머 휠 콜백, 시스템 틱 인터럽트)
+static void task_timeout(tw_timer_t *timer, void *arg) {
+    (void)timer;
+    task_t *t = (task_t *)arg;
+    t->timed_out = true;
+    s_post(s_wake_event);
+}
+
+// ■ 스케줄러 설정 (wake_event: 타임아웃 / 양보 때 post 로 올릴 이벤트, 디스패치에 함께 넘어와야 함)
+void task_sched_init(timer_wheel_t *wheel, void (*post)(uint32_t events), uint32_t wake_event) {
+    s_wheel = wheel;
+    s_post = post;
+    s_wake_event = wake_event;
+}
+
+// ■ 태스크 초기화 (다음 디스패치에서 처음부터 실행, task_sched_init 뒤에)
+void task_init(task_t *t, task_fn_t fn) {
+    t->lc = 0;
+    t->ready = true;
+    t->timed_out = false;
+    t->wait = 0;
+    t->events = 0;
+    t->fn = fn;
+    tw_timer_init(&t->timer, task_timeout, t);
+    s_post(s_wake_event);
+}
+
+// ■ 태스크 실행: 준비됐거나, 기다리던 이벤트가 왔거나, 타임아웃이 난 태스크만 (배열 순서 = 우선순위)
+void task_dispatch(task_t *const tasks[], uint8_t count, uint32_t events) {
+    for (uint8_t i = 0; i < count; i++) {
+        task_t *t = tasks[i];
+        uint32_t hit = t->wait & events;
+        if (!t->ready && hit == 0 && !t->timed_out) continue;
+
+        t->ready = false;
+        t->events = hit;
+        t->fn(t);
+    }
+}
+
+// ■ 대기 시작 (대기 매크로에서 사용)
+void task_await_begin(task_t *t, uint32_t events, uint32_t timeout) {
+    t->wait = events;
+    if (!tw_pending(&t->timer)) { // TASK_WAIT_UNTIL 이 다시 확인할 때는 처음 타임아웃 유지
+        t->timed_out = false;
+        if (timeout != 0) tw_start(s_wheel, &t->timer, timeout, 0);
+    }
+}
+
+// ■ 대기 끝 (깨어난 뒤, 대기 매크로에서 사용): t->events / t->timed_out 은 태스크가 확인할 수 있게 남김
+void task_await_end(task_t *t) {
+    t->wait = 0;
+    tw_cancel(&t->timer);
+}
+
+// ■ 양보: 다음 디스패치에서 바로 실행
+void task_yield(task_t *t) {
+    t->ready = true;
+    s_post(s_wake_event);
+}
+
+// ■ 현재 틱 (마감 시각 계산용)
+uint32_t task_now(void) {
+    return s_wheel->now;
+}
+
+// ■ deadline 틱까지 남은 틱 (이미 지났으면 1 = 다음 틱), 마감 시각 기준 대기 > 실행 지연이 누적되지 않음
+uint32_t task_ticks_until(uint32_t deadline) {
+    int32_t diff = (int32_t)(deadline - s_wheel->now);
+    return (diff > 0) ? (uint32_t)diff : 1U;
+}
@@ -0,0 +1,94 @@
+/***
+ 스택 없는 협력형 태스크 (protothread 방식 코루틴)
+ - 태스크 함수는 대기할 때 return 하고, 다음에 불리면 switch (__LINE__) 로 대기하던 곳부터 이어서 실행
+   > 태스크마다 스택이 필요 없음 (메인 스택 하나, 태스크 상태는 task_t 몇십 바이트)
+ - 기다릴 수 있는 것: 이벤트 (메인 루프 이벤트 비트), 타임아웃 (타이머 휠), 조건
+ - 규칙 (protothread 와 같음)
+   1) 대기를 넘어서 값을 유지해야 하는 변수는 지역 변수 대신 태스크 구조체에 둘 것 (지역 변수는 사라짐)
+   2) 대기 매크로는 한 줄에 하나만 (__LINE__ 으로 위치를 구분)
+   3) 태스크 함수 안에서 다른 switch 로 대기 매크로를 감싸지 말 것
+ - 이벤트는 디스패치 순간에 기다리고 있던 태스크에게만 전달됨 (나중에 기다리기 시작하면 못 받음)
+ - TIMER_WHEEL_HOST 로 PC 에서도 컴파일 가능
+
+ 사용 예)
+   typedef struct { task_t task; uint8_t count; } blink_task_t;   // task 는 첫 번째 멤버
+   uint8_t blink_task(task_t *t) {
+       blink_task_t *b = (blink_task_t *)t;
+       TASK_BEGIN(t);
+       for (b->count = 0; b->count < 10; b->count++) {
+           TASK_SLEEP(t, 500);                        // 500틱 대기
+           TASK_AWAIT(t, EVENT_UART_RX);              // 이벤트 대기
+           TASK_AWAIT_TIMEOUT(t, EVENT_ADC, 100);     // 이벤트 또는 100틱, t->timed_out 으로 구분
+       }
+       TASK_END(t);
+   }
+ ***/
+#ifndef TASK_H
+#define TASK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "timer_wheel.h"
+
+#define TASK_WAITING 0 // 대기 중 (다시 불릴 것)
+#define TASK_ENDED 1   // TASK_END 까지 실행 (다음 디스패치에서 처음부터 다시)
+
+typedef struct task task_t;
+typedef uint8_t (*task_fn_t)(task_t *t);
+
+struct task {
+    uint16_t lc;              // 이어서 실행할 위치 (__LINE__, 0 = 처음)
+    _Bool ready;              // 다음 디스패치에서 바로 실행 (시작, TASK_YIELD)
+    volatile _Bool timed_out; // 타임아웃으로 깨어남 (타이머 휠 콜백이 설정)
+    uint32_t wait;            // 기다리는 이벤트 비트
+    uint32_t events;          // 깨운 이벤트 (wait 중 실제로 온 비트)
+    tw_timer_t timer;         // 타임아웃
+    task_fn_t fn;
+};
+
+void task_sched_init(timer_wheel_t *wheel, void (*post)(uint32_t events), uint32_t wake_event);
+void task_init(task_t *t, task_fn_t fn);
+void task_dispatch(task_t *const tasks[], uint8_t count, uint32_t events);
+void task_await_begin(task_t *t, uint32_t events, uint32_t timeout);
+void task_await_end(task_t *t);
+void task_yield(task_t *t);
+uint32_t task_now(void);
+uint32_t task_ticks_until(uint32_t deadline);
+
+// 일부러 다음 case 로 이어지는 곳 (-Wextra 의 -Wimplicit-fallthrough 경고 없이)
+#if defined(__GNUC__) && (__GNUC__ >= 7)
+ #define TASK_FALLTHROUGH __attribute__((fallthrough))
+#else
+ #define TASK_FALLTHROUGH ((void)0)
+#endif
+
+#define TASK_BEGIN(t)   switch ((t)->lc) { case 0:
+#define TASK_END(t)     } (t)->lc = 0; return TASK_ENDED
+
+// 이벤트(events 중 하나) 가 오거나 timeout 틱이 지날 때까지 대기 (timeout 0: 타임아웃 없음)
+#define TASK_AWAIT_TIMEOUT(t, events, timeout)                                          \
+    do {                                                                                \
+        task_await_begin((t), (events), (timeout));                                     \
+        (t)->lc = __LINE__; return TASK_WAITING; case __LINE__:                         \
+        task_await_end(t);                                                              \
+    } while (0)
+
+#define TASK_AWAIT(t, events)   TASK_AWAIT_TIMEOUT((t), (events), 0)
+#define TASK_SLEEP(t, ticks)    TASK_AWAIT_TIMEOUT((t), 0, (ticks))
+
+// 조건이 참이 될 때까지 대기 (조건은 events 가 올 때마다 / timeout 틱마다 다시 확인)
+#define TASK_WAIT_UNTIL(t, cond, events, timeout)                                       \
+    do {                                                                                \
+        (t)->lc = __LINE__; TASK_FALLTHROUGH; case __LINE__:                            \
+        if (!(cond)) { task_await_begin((t), (events), (timeout)); return TASK_WAITING; } \
+        task_await_end(t);                                                              \
+    } while (0)
+
+// 다른 태스크에게 양보 (다음 디스패치에서 이어서)
+#define TASK_YIELD(t)                                                                   \
+    do {                                                                                \
+        task_yield(t);                                                                  \
+        (t)->lc = __LINE__; return TASK_WAITING; case __LINE__:;                        \
+    } while (0)
+
+#endif /* TASK_H */
@@ -0,0 +1,146 @@
+#include "timer_wheel.h"
+
+#ifdef TIMER_WHEEL_HOST
+ #define TW_CRITICAL_SECTION_DEFINE
+ #define TW_CRITICAL_SECTION_ENTER
+ #define TW_CRITICAL_SECTION_EXIT
+#else
+ #include "bsp_api.h"
+ #define TW_CRITICAL_SECTION_DEFINE FSP_CRITICAL_SECTION_DEFINE
+ #define TW_CRITICAL_SECTION_ENTER FSP_CRITICAL_SECTION_ENTER
+ #define TW_CRITICAL_SECTION_EXIT FSP_CRITICAL_SECTION_EXIT
+#endif
+
+#define TW_MAX_DELTA ((1UL << (TW_LEVEL_BITS * TW_LEVELS)) - 1U) // 휠에 바로 배치할 수 있는 최대 거리
+
+static inline void tw_list_init(tw_node_t *head) {
+    head->next = head;
+    head->prev = head;
+}
+
+static inline void tw_list_add_tail(tw_node_t *head, tw_node_t *node) {
+    node->prev = head->prev;
+    node->next = head;
+    head->prev->next = node;
+    head->prev = node;
+}
+
+static inline void tw_list_del(tw_node_t *node) {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    node->next = (tw_node_t *)0;
+    node->prev = (tw_node_t *)0;
+}
+
+// 슬롯 리스트를 통째로 dst 로 옮기고 슬롯은 비움
+static inline void tw_list_splice(tw_node_t *src, tw_node_t *dst) {
+    if (src->next == src) {
+        tw_list_init(dst);
+        return;
+    }
+    dst->next = src->next;
+    dst->prev = src->prev;
+    dst->next->prev = dst;
+    dst->prev->next = dst;
+    tw_list_init(src);
+}
+
+// ■ 만료 틱에 맞는 슬롯에 넣기 (expires 가 이미 지났으면 다음 틱)
+static void tw_add(timer_wheel_t *w, tw_timer_t *t) {
+    int32_t diff = (int32_t)(t->expires - w->now);
+    uint32_t delta = (diff < 0) ? 0U : (uint32_t)diff;
+    uint32_t when = (delta > TW_MAX_DELTA) ? w->now + TW_MAX_DELTA : w->now + delta; // 너무 멀면 가장 먼 슬롯
+    if (delta > TW_MAX_DELTA) delta = TW_MAX_DELTA;
+
+    uint8_t level = 0;
+    while (level < TW_LEVELS - 1 && delta >= (1UL << (TW_LEVEL_BITS * (level + 1U)))) level++;
+    uint32_t slot = (when >> (TW_LEVEL_BITS * level)) & TW_SLOT_MASK;
+    tw_list_add_tail(&w->slots[level][slot], &t->node);
+}
+
+// ■ 휠 초기화 (now: 시작 틱)
+void tw_init(timer_wheel_t *w, uint32_t now) {
+    w->now = now;
+    for (uint8_t level = 0; level < TW_LEVELS; level++) {
+        for (uint32_t slot = 0; slot < TW_SLOTS; slot++) tw_list_init(&w->slots[level][slot]);
+    }
+}
+
+// ■ 타이머 초기화 (대기 중이 아닌 상태)
+void tw_timer_init(tw_timer_t *t, tw_callback_t callback, void *arg) {
+    t->node.next = (tw_node_t *)0;
+    t->node.prev = (tw_node_t *)0;
+    t->expires = 0;
+    t->period = 0;
+    t->callback = callback;
+    t->arg = arg;
+}
+
+// ■ 타이머 시작: tw_tick delay 번째에 만료 (0 이면 1 과 같이 다음 틱), period 가 0 이 아니면 그 뒤로 period 틱마다
+//   이미 대기 중이면 취소하고 다시 시작
+void tw_start(timer_wheel_t *w, tw_timer_t *t, uint32_t delay, uint32_t period) {
+    TW_CRITICAL_SECTION_DEFINE;
+
+    TW_CRITICAL_SECTION_ENTER;
+    if (tw_pending(t)) tw_list_del(&t->node);
+    t->expires = w->now + ((delay != 0) ? delay - 1U : 0U); // now 는 다음에 처리할 틱
+    t->period = period;
+    tw_add(w, t);
+    TW_CRITICAL_SECTION_EXIT;
+}
+
+// ■ 타이머 취소 (대기 중이 아니면 아무것도 안 함)
+void tw_cancel(tw_timer_t *t) {
+    TW_CRITICAL_SECTION_DEFINE;
+
+    TW_CRITICAL_SECTION_ENTER;
+    if (tw_pending(t)) tw_list_del(&t->node);
+    TW_CRITICAL_SECTION_EXIT;
+}
+
+// ■ 만료까지 남은 tw_tick 횟수 (대기 중이 아니면 0)
+uint32_t tw_remaining(const timer_wheel_t *w, const tw_timer_t *t) {
+    if (!tw_pending(t)) return 0;
+    int32_t diff = (int32_t)(t->expires - w->now);
+    return (diff < 0) ? 1U : (uint32_t)diff + 1U;
+}
+
+// ■ 틱 하나 진행: 상위 레벨 슬롯을 내려보내고, 이번 틱에 만료된 타이머의 콜백 호출
+void tw_tick(timer_wheel_t *w) {
+    uint32_t now = w->now;
+    tw_node_t list;
+
+    // 하위 레벨이 한 바퀴 돌 때마다 상위 레벨 슬롯 하나를 아래로 (그 슬롯 타이머는 모두 다음 TW_SLOTS^level 틱 안에 만료)
+    for (uint8_t level = 1; level < TW_LEVELS; level++) {
+        if ((now & ((1UL << (TW_LEVEL_BITS * level)) - 1U)) != 0) break;
+        uint32_t slot = (now >> (TW_LEVEL_BITS * level)) & TW_SLOT_MASK;
+        tw_list_splice(&w->slots[level][slot], &list);
+        while (list.next != &list) {
+            tw_node_t *node = list.next;
+            tw_list_del(node);
+            tw_add(w, (tw_timer_t *)node);
+        }
+    }
+
+    // 이번 틱 슬롯을 떼어낸 뒤 now 를 먼저 올림 > 콜백에서 시작한 타이머는 빨라도 다음 틱
+    tw_list_splice(&w->slots[0][now & TW_SLOT_MASK], &list);
+    w->now = now + 1U;
+
+    while (list.next != &list) {
+        tw_timer_t *t = (tw_timer_t *)list.next;
+        tw_list_del(&t->node);
+
+        // 가장 먼 슬롯에 임시로 둔 타이머 (아직 만료 전)
+        if ((int32_t)(t->expires - now) > 0) {
+            tw_add(w, t);
+            continue;
+        }
+
+        // 주기 타이머는 콜백 전에 다시 넣음 (만료 시각 기준 > 누적 오차 없음, 콜백에서 취소 가능)
+        if (t->period != 0) {
+            t->expires += t->period;
+            tw_add(w, t);
+        }
+        t->callback(t, t->arg);
+    }
+}
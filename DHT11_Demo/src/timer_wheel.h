@@ -0,0 +1,64 @@
+/***
+ 계층형 타이머 휠 (소프트웨어 타이머)
+ - 시스템 틱 하나(tw_tick)로 여러 개의 one-shot / 주기 타이머를 구동
+ - 시작 / 취소 / 만료 모두 O(1) (타이머 개수와 무관)
+   레벨 0: 1틱 단위 슬롯 TW_SLOTS 개, 레벨 n: TW_SLOTS^n 틱 단위 슬롯 TW_SLOTS 개
+   상위 레벨 슬롯은 차례가 오면 한 단계 아래 레벨로 내려감 (cascade)
+   TW_SLOTS^TW_LEVELS 틱보다 먼 타이머는 가장 먼 슬롯에 두었다가 내려갈 때 다시 계산
+ - 타이머 구조체는 사용하는 쪽이 가지고 있음 (동적 할당 없음, 개수 제한 없음)
+ - 콜백은 tw_tick 안에서 호출 (시스템 틱 인터럽트), 콜백 안에서 시작 / 취소 가능
+ - 틱 카운터는 uint32_t (1kHz 기준 약 49일마다 한 바퀴, 비교는 차이로 하므로 문제 없음)
+ - TIMER_WHEEL_HOST 를 정의하면 FSP 없이 PC 에서 컴파일 가능 (임계구역 없음)
+
+ 사용 예)
+   timer_wheel_t g_wheel;
+   tw_timer_t g_blink;
+   tw_init(&g_wheel, 0);
+   tw_timer_init(&g_blink, blink_callback, NULL);
+   tw_start(&g_wheel, &g_blink, 500, 500);   // 500틱 뒤부터 500틱마다
+   tw_tick(&g_wheel);                        // 시스템 틱마다
+ ***/
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdint.h>
+
+#define TW_LEVEL_BITS 6
+#define TW_SLOTS (1U << TW_LEVEL_BITS)
+#define TW_SLOT_MASK (TW_SLOTS - 1U)
+#define TW_LEVELS 4 // 64^4 틱 = 1kHz 기준 약 4.6시간까지 cascade 없이 바로 배치
+
+typedef struct tw_node {
+    struct tw_node *next;
+    struct tw_node *prev;
+} tw_node_t;
+
+typedef struct tw_timer tw_timer_t;
+typedef void (*tw_callback_t)(tw_timer_t *timer, void *arg);
+
+struct tw_timer {
+    tw_node_t node;         // 슬롯 리스트 연결 (대기 중이 아니면 next == NULL)
+    uint32_t expires;       // 만료 틱
+    uint32_t period;        // 0: one-shot, 그 외: 주기 (틱)
+    tw_callback_t callback;
+    void *arg;
+};
+
+typedef struct {
+    uint32_t now;           // 다음에 처리할 틱
+    tw_node_t slots[TW_LEVELS][TW_SLOTS];
+} timer_wheel_t;
+
+void tw_init(timer_wheel_t *w, uint32_t now);
+void tw_timer_init(tw_timer_t *t, tw_callback_t callback, void *arg);
+void tw_start(timer_wheel_t *w, tw_timer_t *t, uint32_t delay, uint32_t period);
+void tw_cancel(tw_timer_t *t);
+uint32_t tw_remaining(const timer_wheel_t *w, const tw_timer_t *t);
+void tw_tick(timer_wheel_t *w);
+
+// 대기 중인지 (시작했고 아직 만료 / 취소되지 않음, 주기 타이머는 취소 전까지 항상 true)
+static inline _Bool tw_pending(const tw_timer_t *t) {
+    return t->node.next != (tw_node_t *)0;
+}
+
+#endif /* TIMER_WHEEL_H */
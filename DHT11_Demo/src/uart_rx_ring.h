@@ -0,0 +1,48 @@
+/***
+ UART 수신 링버퍼 (SPSC: UART 인터럽트가 쓰고, main loop 가 읽음)
+ - 인터럽트는 받은 바이트를 uart_rx_push() 로 추가만 하고, 명령어 해석은 main loop 에서 uart_rx_pop() 으로
+   > 명령어를 처리하는 동안 다음 명령어가 들어와도 덮어쓰지 않음
+ - 가득 차면 새 바이트를 버리고 overrun 에 기록 (이미 받은 바이트는 그대로)
+ - head 는 인터럽트만, tail 은 main loop 만 변경 > 인터럽트를 막지 않아도 됨
+ - head, tail 은 계속 증가하는 값, 인덱스는 (값 & MASK) 로 계산
+ ***/
+#ifndef UART_RX_RING_H
+#define UART_RX_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UART_RX_RING_SIZE 256  // 반드시 2의 거듭제곱 (head/tail 이 16비트라 최대 32768)
+#define UART_RX_RING_MASK (UART_RX_RING_SIZE - 1)
+
+typedef struct {
+    uint8_t buffer[UART_RX_RING_SIZE];
+    volatile uint16_t head;         // 다음 데이터를 쓸 위치 (UART 인터럽트만 변경)
+    volatile uint16_t tail;         // 다음 읽을 위치     (main loop 만 변경)
+    volatile uint32_t overrun;      // 링버퍼가 가득 차서 버린 바이트 수 (누적)
+    volatile uint32_t hw_overrun;   // UART 하드웨어 오버런 횟수 (UART_EVENT_ERR_OVERFLOW, 누적)
+    uint32_t reported;              // 이미 알린 overrun + hw_overrun 값
+} uart_rx_ring_t;
+
+// ■ 1바이트 추가 (UART 인터럽트에서, 가득 차면 버리고 false)
+static inline _Bool uart_rx_push(uart_rx_ring_t *r, uint8_t data) {
+    uint16_t head = r->head;
+    if ((uint16_t)(head - r->tail) >= UART_RX_RING_SIZE) {
+        r->overrun++; // 가득 참 > 버림
+        return false;
+    }
+    r->buffer[head & UART_RX_RING_MASK] = data;
+    r->head = (uint16_t)(head + 1); // 데이터를 쓴 뒤에 head 갱신 (main loop 가 보는 시점)
+    return true;
+}
+
+// ■ 1바이트 꺼내기 (main loop 에서, 없으면 false)
+static inline _Bool uart_rx_pop(uart_rx_ring_t *r, uint8_t *data) {
+    uint16_t tail = r->tail;
+    if (tail == r->head) return false;
+    *data = r->buffer[tail & UART_RX_RING_MASK];
+    r->tail = (uint16_t)(tail + 1); // 읽은 뒤에 tail 갱신 (ISR 이 보는 시점)
+    return true;
+}
+
+#endif /* UART_RX_RING_H */
@@ -0,0 +1,134 @@
+#include "uart_tx.h"
+#include <string.h>
+
+#ifdef UART_TX_HOST
+ #define UART_TX_CRITICAL_SECTION_DEFINE
+ #define UART_TX_CRITICAL_SECTION_ENTER
+ #define UART_TX_CRITICAL_SECTION_EXIT
+#else
+ #define UART_TX_CRITICAL_SECTION_DEFINE FSP_CRITICAL_SECTION_DEFINE
+ #define UART_TX_CRITICAL_SECTION_ENTER FSP_CRITICAL_SECTION_ENTER
+ #define UART_TX_CRITICAL_SECTION_EXIT FSP_CRITICAL_SECTION_EXIT
+#endif
+
+// ■ 링버퍼 초기화 (UART 를 열기 전에)
+void uart_tx_init(uart_tx_ring_t *tx, uart_instance_t const *uart) {
+    memset(tx, 0, sizeof(*tx));
+    tx->uart = uart;
+}
+
+// ■ UART 열기 (transfer != NULL: 송신에 전송 인스턴스 연결)
+//   전송 인스턴스를 열 수 없으면 (DTC 미지원 설정 등) 연결 없이 다시 열기
+fsp_err_t uart_tx_open(uart_tx_ring_t *tx, transfer_instance_t const *transfer) {
+    tx->cfg = *tx->uart->p_cfg;
+    tx->cfg.p_transfer_tx = transfer;
+    fsp_err_t result = tx->uart->p_api->open(tx->uart->p_ctrl, &tx->cfg);
+    if ((result != FSP_SUCCESS) && (transfer != NULL)) {
+        tx->cfg.p_transfer_tx = NULL;
+        result = tx->uart->p_api->open(tx->uart->p_ctrl, &tx->cfg);
+    }
+    tx->transfer_mode = (result == FSP_SUCCESS) && (tx->cfg.p_transfer_tx != NULL);
+    return result;
+}
+
+// ■ 링버퍼 송신 시작 (송신 중이 아니고, 보낼 데이터가 있으면)
+//   UART 인터럽트 안에서 호출하거나, 인터럽트 막은 상태에서 호출해야 함
+void uart_tx_start_next(uart_tx_ring_t *tx) {
+    if (tx->sending != 0) return; // 이미 송신 중
+
+    uint16_t tail = tx->tail;
+    uint16_t used = (uint16_t)(tx->head - tail);
+    if (used == 0) return; // 보낼 데이터 없음
+
+    // 버퍼 끝에서 잘리지 않는 연속 구간만 한 번에 송신 (나머지는 다음 TX_COMPLETE 에서)
+    uint16_t index = tail & UART_TX_RING_MASK;
+    uint16_t chunk = (uint16_t)(UART_TX_RING_SIZE - index);
+    if (chunk > used) chunk = used;
+
+    tx->sending = chunk;
+    if (tx->uart->p_api->write(tx->uart->p_ctrl, &tx->buffer[index], chunk) != FSP_SUCCESS) {
+        tx->sending = 0; // 송신 시작 실패 > 다음 메시지 때 다시 시도
+        return;
+    }
+    tx->chunks++;
+}
+
+// ■ 송신 완료 (UART_EVENT_TX_COMPLETE): 송신 끝난 만큼 링버퍼 비우고, 남은 데이터 이어서 송신
+void uart_tx_complete(uart_tx_ring_t *tx) {
+    tx->tail = (uint16_t)(tx->tail + tx->sending);
+    tx->sending = 0;
+    uart_tx_start_next(tx);
+}
+
+// ■ 메시지 작성 시작 (현재 링버퍼 빈 공간 확인)
+void tx_msg_begin(uart_tx_ring_t *tx, uart_tx_msg_t *m) {
+    m->tx = tx;
+    m->head = tx->head;
+    m->len = 0;
+    // tail 은 ISR 에서 증가만 하므로, 지금 확인한 빈 공간은 메시지 작성 중에 줄어들지 않음
+    m->space = (uint16_t)(UART_TX_RING_SIZE - (uint16_t)(m->head - tx->tail));
+    m->overflow = false;
+}
+
+// ■ 문자열 추가 (ANSI 색상 코드 포함)
+void tx_msg_str(uart_tx_msg_t *m, const char *str) {
+    while (*str != '\0') tx_msg_byte(m, (uint8_t)*str++);
+}
+
+// ■ 부호 없는 10진수 추가 (width 자리보다 짧으면 앞을 0으로 채움, width=0: 채우지 않음)
+void tx_msg_uint(uart_tx_msg_t *m, uint32_t value, uint8_t width) {
+    char digits[10]; // uint32_t 최대 10자리
+    uint8_t n = 0;
+    do {
+        digits[n++] = (char)('0' + value % 10U);
+        value /= 10U;
+    } while (value != 0U);
+    while (width > n) {
+        tx_msg_byte(m, '0');
+        width--;
+    }
+    while (n > 0) tx_msg_byte(m, (uint8_t)digits[--n]);
+}
+
+// ■ 메시지 작성 끝: 링버퍼에 반영하고 송신 시작 (다 들어가지 않았으면 버리고 false)
+_Bool tx_msg_end(uart_tx_msg_t *m) {
+    uart_tx_ring_t *tx = m->tx;
+    if (m->overflow) {
+        tx->dropped += m->len;
+        return false;
+    }
+    uint16_t used = (uint16_t)(m->head - tx->tail + m->len);
+    if (used > tx->max_used) tx->max_used = used;
+    tx->head = (uint16_t)(m->head + m->len); // 데이터를 다 쓴 뒤에 head 갱신 (ISR 이 보는 시점)
+
+    // 송신 중이 아니면 송신 시작 (ISR 의 TX_COMPLETE 처리와 겹치지 않도록 인터럽트 잠시 막음)
+    UART_TX_CRITICAL_SECTION_DEFINE;
+    UART_TX_CRITICAL_SECTION_ENTER;
+    uart_tx_start_next(tx);
+    UART_TX_CRITICAL_SECTION_EXIT;
+    return true;
+}
+
+// ■ 로그 한 줄 (var == UART_TX_NO_VAR 이면 변수 없음), 링버퍼에 다 들어가지 않으면 버리고 false
+//   tokenized: 문자열 대신 메시지 주소 하위 24비트 + 변수 (RA4M2 코드 플래시 512KB 라 24비트면 충분)
+_Bool uart_tx_log(uart_tx_ring_t *tx, const char *message, uint16_t var, _Bool tokenized) {
+    uart_tx_msg_t msg;
+    tx_msg_begin(tx, &msg);
+    if (tokenized) {
+        uint32_t token = (uint32_t)(uintptr_t)message;
+        tx_msg_byte(&msg, UART_TX_TOKEN_SYNC);
+        tx_msg_byte(&msg, (uint8_t)(token));
+        tx_msg_byte(&msg, (uint8_t)(token >> 8));
+        tx_msg_byte(&msg, (uint8_t)(token >> 16));
+        tx_msg_byte(&msg, (uint8_t)(var));
+        tx_msg_byte(&msg, (uint8_t)(var >> 8));
+        return tx_msg_end(&msg);
+    }
+    tx_msg_str(&msg, message);
+    if (var != UART_TX_NO_VAR) {
+        tx_msg_str(&msg, ": ");
+        tx_msg_uint(&msg, var, 0);
+    }
+    tx_msg_str(&msg, "\r\n\033[0m");
+    return tx_msg_end(&msg); // 전송 완료를 기다리지 않음
+}
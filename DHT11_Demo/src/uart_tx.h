@@ -0,0 +1,89 @@
+/***
+ UART 송신 링버퍼 + 메시지 포맷터 (SPSC: main loop 가 쓰고, UART 송신 완료 인터럽트가 비움)
+ - tx_msg_*() 로 메시지를 링버퍼에 바로 작성 (sprintf / 중간 버퍼 없음), tx_msg_end() 에서 한 번에 반영하고 송신 시작
+   전송 완료를 기다리지 않음 > 로그가 많아도 메인 루프가 멈추지 않음
+   지원하는 변환: 문자열 (ANSI 색상 코드 포함), 부호 없는 10진수, 0으로 채운 자릿수 (mm:ss)
+ - 메시지가 링버퍼에 다 들어가지 않으면 통째로 버리고 dropped 에 기록
+ - 송신은 FSP UART 인터페이스 (uart_instance_t) 의 write 로, 링버퍼의 연속 구간을 한 번에 넘김
+   UART 콜백의 UART_EVENT_TX_COMPLETE 에서 uart_tx_complete() 를 부르면 남은 데이터를 이어서 송신
+ - head, tail 은 계속 증가하는 값, 인덱스는 (값 & MASK) 로 계산
+ - uart_tx_open() 에 전송 인스턴스 (r_dtc 의 transfer_instance_t) 를 주면 UART 설정의 p_transfer_tx 로 연결해서 열기
+   > write 한 번을 DTC 가 통째로 보내고, 끝날 때 인터럽트만 발생 (연결 안 하면 TXI 인터럽트로 1바이트씩)
+   전송 인스턴스 열기에 실패하면 전송 없이 다시 열어서 기존 방식으로 동작 (transfer_mode 로 확인)
+ - uart_tx_log(): 로그 한 줄 "메시지: 변수\r\n" (텍스트) 또는 [0xFE][메시지 주소 3바이트][변수 2바이트] (토큰, 6바이트)
+   토큰 모드의 메시지 주소 = 플래시(.rodata) 문자열 상수 주소 > PC 에서 ELF 로 복원 (tools/uart_log_decode.py)
+ - UART_TX_HOST 를 정의하면 PC 에서도 컴파일 가능 (임계구역 없음, UART 는 가짜 uart_instance_t)
+
+ 사용 예)
+   uart_tx_ring_t g_tx;
+   uart_tx_init(&g_tx, &g_uart0);
+   uart_tx_open(&g_tx, NULL);        // 또는 uart_tx_open(&g_tx, &g_transfer_uart_tx);
+   uart_tx_msg_t msg;
+   tx_msg_begin(&g_tx, &msg);
+   tx_msg_str(&msg, "ADC: ");
+   tx_msg_uint(&msg, 1234, 0);
+   tx_msg_end(&msg);                 // 송신 시작 (바로 반환)
+   uart_tx_complete(&g_tx);          // UART_EVENT_TX_COMPLETE 에서
+ ***/
+#ifndef UART_TX_H
+#define UART_TX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "r_uart_api.h"
+
+#define UART_TX_RING_SIZE 1024  // 반드시 2의 거듭제곱 (head/tail 이 16비트라 최대 32768)
+#define UART_TX_RING_MASK (UART_TX_RING_SIZE - 1)
+// 한 번에 넘기는 구간은 링버퍼 크기 이하 > DTC 1회 최대 전송 (r_sci_uart.c SCI_UART_DTC_MAX_TRANSFER, 0x10000) 도 항상 만족
+#if ((UART_TX_RING_SIZE & UART_TX_RING_MASK) != 0) || (UART_TX_RING_SIZE > 0x8000)
+#error "UART_TX_RING_SIZE 는 32768 이하의 2의 거듭제곱이어야 함"
+#endif
+
+typedef struct {
+    uint8_t buffer[UART_TX_RING_SIZE];
+    volatile uint16_t head;     // 다음 데이터를 쓸 위치 (main loop 만 변경)
+    volatile uint16_t tail;     // 다음 송신할 위치     (UART 인터럽트만 변경)
+    volatile uint16_t sending;  // write 로 송신 중인 바이트 수 (0: 송신 중 아님)
+    volatile uint32_t dropped;  // 공간 부족으로 버려진 바이트 수 (누적)
+    uint32_t reported;          // 이미 알린 dropped 값
+    uint16_t max_used;          // 최대 사용량 (바이트, 버퍼 크기 조정 참고용)
+    uint32_t chunks;            // write 로 넘긴 구간 수 (DTC 모드: 구간마다 인터럽트 2번, 아니면 바이트 수 + 1번)
+    _Bool transfer_mode;        // true: 전송 인스턴스(DTC) 로 송신 (uart_tx_open 에서 설정)
+    uart_instance_t const *uart;
+    uart_cfg_t cfg;             // UART 설정 복사본 (p_transfer_tx 연결용, 드라이버가 열려 있는 동안 계속 참조)
+} uart_tx_ring_t;
+
+#define UART_TX_NO_VAR 65535   // uart_tx_log: 변수 없음 (uint16_t 최댓값)
+#define UART_TX_TOKEN_SYNC 0xFE // 토큰 시작 (UTF-8 에 나오지 않는 바이트 > 일반 텍스트와 섞여도 구분)
+#define UART_TX_TOKEN_LEN 6     // sync 1 + 메시지 주소 3 + 변수 2
+
+// 링버퍼에 직접 작성 중인 메시지 (tx_msg_end() 전까지 ISR 에 보이지 않음)
+typedef struct {
+    uart_tx_ring_t *tx;
+    uint16_t head;      // 메시지 시작 위치 (링버퍼 head)
+    uint16_t len;       // 지금까지 추가한 바이트 수 (overflow 이면 space 보다 큼)
+    uint16_t space;     // 시작할 때의 빈 공간
+    _Bool overflow;     // 빈 공간 부족
+} uart_tx_msg_t;
+
+void uart_tx_init(uart_tx_ring_t *tx, uart_instance_t const *uart);
+fsp_err_t uart_tx_open(uart_tx_ring_t *tx, transfer_instance_t const *transfer);
+void uart_tx_start_next(uart_tx_ring_t *tx);
+void uart_tx_complete(uart_tx_ring_t *tx);
+void tx_msg_begin(uart_tx_ring_t *tx, uart_tx_msg_t *m);
+void tx_msg_str(uart_tx_msg_t *m, const char *str);
+void tx_msg_uint(uart_tx_msg_t *m, uint32_t value, uint8_t width);
+_Bool tx_msg_end(uart_tx_msg_t *m);
+_Bool uart_tx_log(uart_tx_ring_t *tx, const char *message, uint16_t var, _Bool tokenized);
+
+// ■ 1바이트 추가
+static inline void tx_msg_byte(uart_tx_msg_t *m, uint8_t c) {
+    if (m->len < m->space) {
+        m->tx->buffer[(uint16_t)(m->head + m->len) & UART_TX_RING_MASK] = c;
+    } else {
+        m->overflow = true; // 공간 부족 (길이는 계속 세서 dropped 에 메시지 전체 길이가 기록되게 함)
+    }
+    m->len++;
+}
+
+#endif /* UART_TX_H */
@@ -0,0 +1 @@
+/* PC 빌드용 빈 arm_acle.h (CMSIS 헤더가 include 하지만, 호스트 테스트에서는 ARM 내장 함수를 쓰지 않음) */
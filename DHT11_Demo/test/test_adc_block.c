@@ -0,0 +1,187 @@
+/***
+ adc_block (ADC 핑퐁 블록 수집) 호스트 테스트
+ - 생산자: 640 Hz 하드웨어 트리거 ADC (가상 시간), 샘플 값 = 일련번호 (빠짐 / 섞임 / 찢어짐 확인용)
+   샘플마다   : 스캔 완료 콜백에서 adc_block_write() (지금 펌웨어 경로)
+   가짜 전송  : transfer_api_t (open / reset) 만 구현한 가짜 DTC 가 샘플을 목적지로 옮기고,
+                블록이 끝나면 완료 인터럽트에서 adc_block_filled() + reset(다음 목적지)
+ - 소비자: 이벤트 후 무작위 지연 뒤 adc_block_peek(), 처리 시간 동안 블록이 바뀌지 않는지 확인 후 adc_block_release()
+ - 확인: 블록 안은 연속된 64개 (블록 경계 정렬), 블록 순서 증가, 처리 + overrun + 대기 = 완성 블록 수,
+         처리 시간이 블록 하나 (100 ms) 안이면 overrun 0, CPU 인터럽트 수 (샘플마다 64번 / 전송 1번)
+ ***/
+#include "test_util.h"
+#include <stdlib.h>
+#include <string.h>
+#include "hal_data.h"
+#include "adc_block.h"
+
+#define SAMPLE_RATE_HZ 640U
+#define SAMPLE_NS (1000000000ULL / SAMPLE_RATE_HZ)
+
+/*** 가짜 전송 인스턴스 (r_dtc 대신: ADC 데이터 레지스터 > 블록, 정해진 개수 후 완료 인터럽트) ***/
+typedef struct {
+    uint32_t opens;
+    uint32_t resets;
+    const volatile uint16_t *src;   // ADC 데이터 레지스터
+    uint16_t *dest;                 // 다음 목적지
+    uint16_t remain;                // 남은 전송 수
+} fake_transfer_t;
+
+static fake_transfer_t g_dtc;
+static volatile uint16_t g_adc_register;  // 가짜 ADDR0
+
+static fsp_err_t fake_transfer_open(transfer_ctrl_t * const p_ctrl, transfer_cfg_t const * const p_cfg) {
+    (void)p_ctrl; (void)p_cfg;
+    g_dtc.opens++;
+    return FSP_SUCCESS;
+}
+
+static fsp_err_t fake_transfer_reset(transfer_ctrl_t * const p_ctrl, void const * p_src, void * p_dest,
+                                     uint16_t const num_transfers) {
+    (void)p_ctrl;
+    g_dtc.resets++;
+    g_dtc.src = p_src;
+    g_dtc.dest = p_dest;
+    g_dtc.remain = num_transfers;
+    return FSP_SUCCESS;
+}
+
+static const transfer_api_t g_fake_transfer_api = { .open = fake_transfer_open, .reset = fake_transfer_reset };
+static const transfer_instance_t g_fake_transfer = { .p_ctrl = NULL, .p_cfg = NULL, .p_api = &g_fake_transfer_api };
+
+/*** 시뮬레이션 ***/
+static adc_block_buf_t g_blocks;
+static uint32_t g_irqs;             // CPU 가 처리한 인터럽트 수
+static _Bool g_event;               // EVENT_ADC
+
+typedef struct {
+    _Bool use_transfer;
+    uint32_t delay_max_ms;          // 이벤트 후 처리 시작까지 최대 지연
+    uint32_t proc_min_ms;           // 블록 처리 시간 (무작위 min ~ max)
+    uint32_t proc_max_ms;
+} scenario_t;
+
+typedef struct {
+    uint32_t produced;              // 완성된 블록 수 (생산자 기준)
+    uint32_t processed;
+    uint32_t bad_block;             // 연속이 아니거나 경계가 맞지 않는 블록
+    uint32_t bad_order;
+    uint32_t torn;                  // 처리 중에 내용이 바뀐 블록
+    uint32_t irqs;
+} result_t;
+
+// ■ 전송 완료 인터럽트 (가짜 DTC 가 블록을 다 옮김)
+static void transfer_end_isr(void) {
+    g_irqs++;
+    _Bool handed;
+    uint16_t *next = adc_block_filled(&g_blocks, &handed);
+    g_fake_transfer.p_api->reset(g_fake_transfer.p_ctrl, (void const *)&g_adc_register, next, ADC_BLOCK_SIZE);
+    if (handed) g_event = true;
+}
+
+static result_t simulate(const scenario_t *sc, uint32_t seconds) {
+    result_t r = {0};
+    adc_block_reset(&g_blocks);
+    memset(&g_dtc, 0, sizeof(g_dtc));
+    g_irqs = 0;
+    g_event = false;
+    if (sc->use_transfer) {
+        g_fake_transfer.p_api->open(g_fake_transfer.p_ctrl, g_fake_transfer.p_cfg);
+        g_fake_transfer.p_api->reset(g_fake_transfer.p_ctrl, (void const *)&g_adc_register,
+                                     adc_block_fill_ptr(&g_blocks), ADC_BLOCK_SIZE);
+    }
+
+    uint16_t sample = 0;
+    uint64_t end = (uint64_t)seconds * 1000000000ULL;
+    uint64_t start_at = UINT64_MAX;     // 소비자가 다음 블록을 집는 시각
+    uint64_t done_at = UINT64_MAX;      // 소비자 처리 끝 시각
+    const uint16_t *busy = NULL;        // 처리 중인 블록
+    uint16_t snapshot[ADC_BLOCK_SIZE];
+    int32_t last_first = -1;
+    uint64_t next_sample = SAMPLE_NS;
+
+    while (next_sample < end) {
+        uint64_t now = next_sample;
+        if (start_at < now) now = start_at;
+        if (done_at < now) now = done_at;
+
+        if (now == next_sample) {
+            // ADC 스캔 완료
+            g_adc_register = sample++;
+            if (sc->use_transfer) {
+                *g_dtc.dest++ = *g_dtc.src; // CPU 없이 옮김
+                if (--g_dtc.remain == 0) transfer_end_isr();
+            }
+            else {
+                g_irqs++;
+                if (adc_block_write(&g_blocks, g_adc_register)) g_event = true;
+            }
+            if ((uint16_t)(sample % ADC_BLOCK_SIZE) == 0) r.produced++;
+            next_sample += SAMPLE_NS;
+        }
+        if (now == done_at) {
+            // 처리 끝: 그동안 블록이 바뀌지 않았는지
+            if (memcmp(busy, snapshot, sizeof(snapshot)) != 0) r.torn++;
+            adc_block_release(&g_blocks);
+            r.processed++;
+            busy = NULL;
+            done_at = UINT64_MAX;
+            g_event = true; // 밀린 블록이 있으면 이어서
+        }
+        if (g_event && busy == NULL && start_at == UINT64_MAX) {
+            g_event = false;
+            uint64_t delay_us = sc->delay_max_ms ? (uint64_t)(rand() % (int)(sc->delay_max_ms * 1000U)) : 0U;
+            start_at = now + delay_us * 1000U;
+        }
+        if (now == start_at) {
+            start_at = UINT64_MAX;
+            const uint16_t *block = adc_block_peek(&g_blocks);
+            if (block != NULL) {
+                busy = block;
+                memcpy(snapshot, block, sizeof(snapshot));
+                _Bool contiguous = (block[0] % ADC_BLOCK_SIZE) == 0;
+                for (uint32_t i = 1; i < ADC_BLOCK_SIZE; i++) if (block[i] != (uint16_t)(block[0] + i)) contiguous = false;
+                if (!contiguous) r.bad_block++;
+                if ((int32_t)block[0] <= last_first) r.bad_order++;
+                last_first = block[0];
+                uint32_t span = sc->proc_max_ms - sc->proc_min_ms;
+                uint64_t proc_us = (uint64_t)sc->proc_min_ms * 1000U + (span ? (uint64_t)(rand() % (int)(span * 1000U)) : 0);
+                done_at = now + proc_us * 1000ULL;
+            }
+        }
+    }
+    r.irqs = g_irqs;
+    return r;
+}
+
+static void run(const char *name, const scenario_t *sc, _Bool expect_overrun) {
+    result_t r = simulate(sc, 60); // 샘플 38400 개 < 65536 (일련번호가 넘어가지 않음)
+    uint32_t waiting = (uint32_t)g_blocks.ready[0] + (uint32_t)g_blocks.ready[1];
+    CHECK_EQ(r.bad_block, 0);
+    CHECK_EQ(r.bad_order, 0);
+    CHECK_EQ(r.torn, 0);
+    CHECK_EQ(r.processed + g_blocks.overrun + waiting, r.produced);
+    if (expect_overrun) CHECK(g_blocks.overrun > 0);
+    else CHECK_EQ(g_blocks.overrun, 0);
+    if (sc->use_transfer) {
+        CHECK_EQ(r.irqs, r.produced);
+        CHECK_EQ(g_dtc.resets, r.produced + 1);
+    }
+    else CHECK_EQ(r.irqs / ADC_BLOCK_SIZE, r.produced); // 마지막 채우던 블록은 완성 전
+    printf("  %s, %s: 블록 %u, 처리 %u, overrun %u, CPU 인터럽트 %u (블록당 %.0f)\n",
+           name, sc->use_transfer ? "가짜 전송" : "샘플마다", (unsigned)r.produced, (unsigned)r.processed,
+           (unsigned)g_blocks.overrun, (unsigned)r.irqs, (double)r.irqs / r.produced);
+}
+
+int main(void) {
+    srand(1);
+    for (int t = 0; t < 2; t++) {
+        _Bool transfer = (t == 1);
+        scenario_t fast = { transfer, 5, 1, 20 };
+        scenario_t tight = { transfer, 0, 95, 99 };     // 처리 시간 거의 블록 하나
+        scenario_t slow = { transfer, 20, 30, 250 };    // 가끔 블록 하나 이상 밀림
+        run("처리 1~20 ms, 지연 ~5 ms", &fast, false);
+        run("처리 95~99 ms", &tight, false);
+        run("처리 30~250 ms, 지연 ~20 ms", &slow, true);
+    }
+    return TEST_END();
+}
@@ -0,0 +1,357 @@
+/***
+ bin_proto (바이너리 프로토콜) 루프백 테스트
+ PC (요청 인코더 + 응답 디코더) <> 가상 UART 115200 baud <> 펌웨어 (uart_rx_ring + bin_proto + uart_tx + timer_wheel)
+ - 펌웨어 쪽 처리 순서는 hal_entry.c process_command() 와 같음 (바이너리 / ASCII 구분, 시간 초과, 응답 자리 대기)
+ - 실행은 가짜 (cmd_parser 로 형식만 확인, 실행한 명령어 기록)
+ - 시나리오: 파이프라인 200개, 바이트 손실 (중간 / 끝), 길이 바이트 깨짐, CRC 오류, 송신 링버퍼 가득 (응답 대기)
+ ***/
+#include "test_util.h"
+#include <string.h>
+#include "uart_rx_ring.h"
+#include "uart_tx.h"
+#include "bin_proto.h"
+#include "cmd_parser.h"
+#include "timer_wheel.h"
+
+#define BAUD 115200U
+#define BYTE_NS (10U * 1000000000ULL / BAUD)
+#define TICK_NS 1000000ULL  // 1 kHz 시스템 틱
+#define MAX_FRAMES 256
+
+/*** 가상 시간 / UART ***/
+static uint64_t g_now;
+static uint8_t g_pc_tx[1 << 15];        // PC > 펌웨어 바이트
+static uint32_t g_pc_tx_len, g_pc_tx_pos;
+static uint64_t g_pc_tx_next;           // 다음 바이트 도착 시각
+static uint32_t g_pc_tx_pause_pos;      // 이 위치까지 보낸 뒤 잠시 멈춤 (UINT32_MAX: 없음)
+static uint64_t g_pc_tx_pause_at;       // 멈춘 뒤 다시 보내는 시각
+static uint64_t g_next_tick;
+
+static const uint8_t *g_tx_src;         // 펌웨어 > PC 송신 중인 구간
+static uint32_t g_tx_bytes;
+static uint64_t g_tx_done;
+
+/*** 펌웨어 쪽 ***/
+static uart_rx_ring_t g_rx;
+static uart_tx_ring_t g_tx;
+static bin_rx_t g_bin;
+static cmd_parser_t g_ascii;
+static cmd_parser_t g_exec_parser;
+static timer_wheel_t g_wheel;
+static tw_timer_t g_bin_timer;
+static _Bool g_bin_timeout;
+static _Bool g_event;                   // EVENT_UART_RX
+static uint32_t g_ascii_ready, g_ascii_error;
+
+static char g_executed[MAX_FRAMES][BIN_PAYLOAD_MAX + 1];
+static uint32_t g_exec_count;
+
+/*** PC 쪽 ***/
+static int g_reply[256];                // seq > 상태 (-1: 아직 없음)
+static uint32_t g_replies;
+static uint8_t g_dec_buf[64];
+static uint32_t g_dec_len;
+static uint32_t g_pc_rx_other;          // 응답이 아닌 바이트 (로그)
+
+static fsp_err_t fake_write(uart_ctrl_t * const p_ctrl, uint8_t const * const p_src, uint32_t const bytes) {
+    (void)p_ctrl;
+    if (g_tx_bytes != 0) return FSP_ERR_IN_USE;
+    g_tx_src = p_src;
+    g_tx_bytes = bytes;
+    g_tx_done = g_now + bytes * BYTE_NS;
+    return FSP_SUCCESS;
+}
+static const uart_api_t g_fake_api = { .write = fake_write };
+static const uart_instance_t g_fake_uart = { .p_ctrl = NULL, .p_cfg = NULL, .p_api = &g_fake_api };
+
+// ■ 가짜 실행: HDR + 명령어 + TAIL 이 형식에 맞는지만 확인하고 기록
+static bin_status_t fake_execute(const uint8_t *payload, uint8_t len) {
+    cmd_parser_reset(&g_exec_parser);
+    for (uint8_t i = 0; i < 3; i++) cmd_parser_feed(&g_exec_parser, (uint8_t)HEADER[i]);
+    for (uint8_t i = 0; i < len; i++) {
+        if (payload[i] == END_CHARACTER) return BIN_STATUS_CMD;
+        cmd_parser_feed(&g_exec_parser, payload[i]);
+    }
+    for (uint8_t i = 0; i < 4; i++) cmd_parser_feed(&g_exec_parser, (uint8_t)TAIL[i]);
+    if (cmd_parser_feed(&g_exec_parser, END_CHARACTER) != CMD_RESULT_READY) return BIN_STATUS_CMD;
+    if (g_exec_count < MAX_FRAMES) {
+        memcpy(g_executed[g_exec_count], payload, len);
+        g_executed[g_exec_count][len] = '\0';
+    }
+    g_exec_count++;
+    return BIN_STATUS_OK;
+}
+
+static void bin_timeout_tick(tw_timer_t *timer, void *arg) {
+    (void)timer; (void)arg;
+    g_bin_timeout = true;
+    g_event = true;
+}
+
+// ■ hal_entry.c process_command() 와 같은 순서
+static void process(void) {
+    if (!bin_rx_finish(&g_bin, &g_tx, fake_execute)) return;
+    if (g_bin_timeout) {
+        g_bin_timeout = false;
+        if (g_rx.head == g_rx.tail) bin_rx_timeout(&g_bin);
+    }
+    uint8_t data;
+    while (uart_rx_pop(&g_rx, &data)) {
+        if (bin_rx_owns(&g_bin, data, g_ascii.state == CMD_STATE_HEADER && g_ascii.match == 0)) {
+            bin_rx_feed(&g_bin, data);
+            tw_start(&g_wheel, &g_bin_timer, BIN_RX_TIMEOUT_MS, 0);
+            if (!bin_rx_finish(&g_bin, &g_tx, fake_execute)) return;
+            continue;
+        }
+        switch (cmd_parser_feed(&g_ascii, data)) {
+            case CMD_RESULT_READY: g_ascii_ready++; break;
+            case CMD_RESULT_ERROR: g_ascii_error++; break;
+            case CMD_RESULT_NONE: break;
+        }
+    }
+}
+
+// ■ PC 쪽 응답 디코더 (응답 프레임만 골라냄, tools/uart_bin_client.py FrameDecoder 와 같은 방식)
+static void pc_rx(uint8_t c) {
+    g_dec_buf[g_dec_len++] = c;
+    while (g_dec_len > 0) {
+        if (g_dec_buf[0] != BIN_SYNC) {
+            g_pc_rx_other++;
+            memmove(g_dec_buf, g_dec_buf + 1, --g_dec_len);
+            continue;
+        }
+        if (g_dec_len < BIN_REPLY_SIZE) return;
+        uint16_t crc = 0xFFFF;
+        for (int i = 1; i < 4; i++) crc = crc16_update(crc, g_dec_buf[i]);
+        if (g_dec_buf[1] == 1 && (g_dec_buf[4] | (g_dec_buf[5] << 8)) == crc) {
+            CHECK(g_reply[g_dec_buf[2]] == -1); // seq 마다 응답 하나
+            g_reply[g_dec_buf[2]] = g_dec_buf[3];
+            g_replies++;
+            g_dec_len = 0;
+            return;
+        }
+        g_pc_rx_other++;
+        memmove(g_dec_buf, g_dec_buf + 1, --g_dec_len);
+    }
+}
+
+// ■ 요청 프레임 추가
+static uint32_t pc_send(uint8_t seq, const char *cmd) {
+    uint32_t start = g_pc_tx_len;
+    uint8_t len = (uint8_t)strlen(cmd);
+    g_pc_tx[g_pc_tx_len++] = BIN_SYNC;
+    g_pc_tx[g_pc_tx_len++] = len;
+    g_pc_tx[g_pc_tx_len++] = seq;
+    memcpy(&g_pc_tx[g_pc_tx_len], cmd, len);
+    g_pc_tx_len += len;
+    uint16_t crc = 0xFFFF;
+    for (uint32_t i = start + 1; i < g_pc_tx_len; i++) crc = crc16_update(crc, g_pc_tx[i]);
+    g_pc_tx[g_pc_tx_len++] = (uint8_t)crc;
+    g_pc_tx[g_pc_tx_len++] = (uint8_t)(crc >> 8);
+    return start;
+}
+
+static void pc_send_ascii(const char *s) {
+    size_t n = strlen(s);
+    memcpy(&g_pc_tx[g_pc_tx_len], s, n);
+    g_pc_tx_len += (uint32_t)n;
+}
+
+// ■ 바이트 삭제 (전송 중 손실)
+static void pc_lose_byte(uint32_t pos) {
+    memmove(&g_pc_tx[pos], &g_pc_tx[pos + 1], g_pc_tx_len - pos - 1);
+    g_pc_tx_len--;
+}
+
+static void reset(void) {
+    g_now = 0;
+    g_pc_tx_len = g_pc_tx_pos = 0;
+    g_pc_tx_next = 0;
+    g_pc_tx_pause_at = UINT64_MAX;
+    g_pc_tx_pause_pos = UINT32_MAX;
+    g_next_tick = TICK_NS;
+    g_tx_bytes = 0;
+    memset(&g_rx, 0, sizeof(g_rx));
+    uart_tx_init(&g_tx, &g_fake_uart);
+    bin_rx_reset(&g_bin);
+    cmd_parser_reset(&g_ascii);
+    tw_init(&g_wheel, 0);
+    tw_timer_init(&g_bin_timer, bin_timeout_tick, NULL);
+    g_bin_timeout = g_event = false;
+    g_ascii_ready = g_ascii_error = 0;
+    g_exec_count = 0;
+    for (int i = 0; i < 256; i++) g_reply[i] = -1;
+    g_replies = 0;
+    g_dec_len = 0;
+    g_pc_rx_other = 0;
+}
+
+// ■ 가상 시간으로 until_ns 까지 실행 (바이트 송수신 + 시스템 틱), on_tick: 틱마다 추가 동작 (NULL: 없음)
+static void run(uint64_t until_ns, void (*on_tick)(void)) {
+    while (g_now < until_ns) {
+        uint64_t next = g_next_tick;
+        if (g_pc_tx_pos < g_pc_tx_len && g_pc_tx_next < next) next = g_pc_tx_next;
+        if (g_tx_bytes != 0 && g_tx_done < next) next = g_tx_done;
+        g_now = next;
+
+        if (g_pc_tx_pos < g_pc_tx_len && g_pc_tx_next == g_now) {
+            // UART_EVENT_RX_CHAR
+            uart_rx_push(&g_rx, g_pc_tx[g_pc_tx_pos++]);
+            g_event = true;
+            g_pc_tx_next = g_now + BYTE_NS;
+            if (g_pc_tx_pos == g_pc_tx_pause_pos) g_pc_tx_next = g_pc_tx_pause_at; // PC 가 잠시 멈춤
+        }
+        if (g_tx_bytes != 0 && g_tx_done == g_now) {
+            // UART_EVENT_TX_COMPLETE
+            for (uint32_t i = 0; i < g_tx_bytes; i++) pc_rx(g_tx_src[i]);
+            g_tx_bytes = 0;
+            uart_tx_complete(&g_tx);
+            if (g_bin.pending) g_event = true;
+        }
+        if (g_next_tick == g_now) {
+            tw_tick(&g_wheel);
+            g_next_tick += TICK_NS;
+            if (on_tick != NULL) on_tick();
+        }
+        if (g_event) {
+            g_event = false;
+            process();
+        }
+    }
+}
+
+static const char *g_cmds[] = { "R50", "G10;B40", "T10ON", "R50F2000", "S", "AON", "B100", "R0;G0;B100" };
+#define N_CMDS (sizeof(g_cmds) / sizeof(g_cmds[0]))
+
+// ■ 파이프라인: 응답을 기다리지 않고 200개 연속 송신
+static void test_pipeline(void) {
+    reset();
+    for (uint32_t i = 0; i < 200; i++) pc_send((uint8_t)i, g_cmds[i % N_CMDS]);
+    run(1000000000ULL, NULL);
+    CHECK_EQ(g_replies, 200);
+    uint32_t bad = 0;
+    for (uint32_t i = 0; i < 200; i++) if (g_reply[i] != BIN_STATUS_OK) bad++;
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(g_exec_count, 200);
+    bad = 0;
+    for (uint32_t i = 0; i < 200; i++) if (strcmp(g_executed[i], g_cmds[i % N_CMDS]) != 0) bad++;
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(g_bin.crc_errors + g_bin.len_errors + g_bin.timeouts + g_bin.skipped, 0);
+    CHECK_EQ(g_ascii_error, 0);
+    CHECK(!g_bin.active); // 마지막 바이트 뒤 50 ms 지나면 세션 끝
+}
+
+// ■ 중간 바이트 손실: 그 프레임 (+ 다음 프레임) 만 잃고, 잘못된 명령어는 실행하지 않음, 이후 정상
+static void test_lost_byte(void) {
+    reset();
+    uint32_t pos[40];
+    for (uint32_t i = 0; i < 40; i++) pos[i] = pc_send((uint8_t)i, g_cmds[i % N_CMDS]);
+    pc_lose_byte(pos[10] + 4); // 10번 프레임 명령어 두 번째 바이트
+    run(1000000000ULL, NULL);
+    CHECK(g_reply[10] == -1 || g_reply[10] == BIN_STATUS_CRC);
+    uint32_t ok = 0;
+    for (uint32_t i = 0; i < 40; i++) if (g_reply[i] == BIN_STATUS_OK) ok++;
+    CHECK(ok >= 38);
+    for (uint32_t i = 12; i < 40; i++) CHECK_EQ(g_reply[i], BIN_STATUS_OK);
+    CHECK_EQ(g_exec_count, ok); // CRC 가 맞은 프레임만 실행
+    CHECK_EQ(g_ascii_error, 0); // 깨진 바이트가 ASCII 파서로 가지 않음
+    printf("  바이트 손실 (중간): 40개 중 %u 개 정상, CRC 오류 %u, 건너뛴 바이트 %u\n",
+           ok, (unsigned)g_bin.crc_errors, (unsigned)g_bin.skipped);
+
+    // 마지막 프레임이 잘림 > 50 ms 뒤 시간 초과로 버리고, 이어지는 ASCII 명령어는 정상 처리
+    reset();
+    pc_send(1, "R50");
+    uint32_t last = pc_send(2, "G10");
+    g_pc_tx_len = last + 4; // 명령어 중간에서 끊김
+    g_pc_tx_pause_pos = g_pc_tx_len;
+    g_pc_tx_pause_at = 200000000ULL; // 200 ms 뒤 ASCII 명령어
+    pc_send_ascii("HDRR5TAIL\r");
+    run(400000000ULL, NULL);
+    CHECK_EQ(g_reply[1], BIN_STATUS_OK);
+    CHECK_EQ(g_reply[2], -1);
+    CHECK_EQ(g_bin.timeouts, 1);
+    CHECK_EQ(g_bin.state, BIN_STATE_IDLE);
+    CHECK_EQ(g_ascii_ready, 1);
+    CHECK_EQ(g_ascii_error, 0);
+}
+
+// ■ 길이 바이트 깨짐: seq 직후 바로 LEN 응답 (명령어 바이트를 기다리지 않음), 이후 프레임 정상
+static void test_corrupt_len(void) {
+    reset();
+    uint32_t pos[30];
+    for (uint32_t i = 0; i < 30; i++) pos[i] = pc_send((uint8_t)i, g_cmds[i % N_CMDS]);
+    g_pc_tx[pos[5] + 1] = 200;
+    run(1000000000ULL, NULL);
+    CHECK_EQ(g_reply[5], BIN_STATUS_LEN);
+    CHECK_EQ(g_bin.len_errors, 1);
+    uint32_t ok = 0;
+    for (uint32_t i = 0; i < 30; i++) if (i != 5 && g_reply[i] == BIN_STATUS_OK) ok++;
+    CHECK_EQ(ok, 29);
+    CHECK_EQ(g_exec_count, 29);
+    CHECK_EQ(g_ascii_error, 0);
+    printf("  길이 깨짐: LEN 응답 1, 나머지 %u/29 정상 (건너뛴 바이트 %u)\n", ok, (unsigned)g_bin.skipped);
+}
+
+// ■ CRC 오류: 실행하지 않고 CRC 응답, 다음 프레임은 정상
+static void test_crc(void) {
+    reset();
+    uint32_t pos[20];
+    for (uint32_t i = 0; i < 20; i++) pos[i] = pc_send((uint8_t)i, g_cmds[i % N_CMDS]);
+    g_pc_tx[pos[7] + 3] ^= 0x01;  // 명령어 첫 바이트
+    g_pc_tx[pos[12] + 3 + strlen(g_cmds[12 % N_CMDS])] ^= 0x80; // CRC 하위
+    run(1000000000ULL, NULL);
+    CHECK_EQ(g_reply[7], BIN_STATUS_CRC);
+    CHECK_EQ(g_bin.crc_errors, 2);
+    CHECK_EQ(g_exec_count, 18);
+    for (uint32_t i = 0; i < 20; i++) if (i != 7 && i != 12) CHECK_EQ(g_reply[i], BIN_STATUS_OK);
+    CHECK_EQ(g_reply[12], BIN_STATUS_CRC);
+}
+
+// ■ 송신 링버퍼가 로그로 가득: 응답을 버리지 않고 자리가 날 때까지 기다렸다가 보냄
+static void log_burst(void) {
+    // 시작 직후 한 번, 송신 링버퍼를 거의 채우는 로그 (바이너리 요청이 도착하기 전)
+    if (g_now == TICK_NS) {
+        uart_tx_msg_t msg;
+        tx_msg_begin(&g_tx, &msg);
+        for (int i = 0; i < 600; i++) tx_msg_byte(&msg, 'L');
+        tx_msg_end(&msg);
+        tx_msg_begin(&g_tx, &msg);
+        for (int i = 0; i < UART_TX_RING_SIZE - 600 - 3; i++) tx_msg_byte(&msg, 'M');
+        tx_msg_end(&msg);
+    }
+}
+
+static void test_tx_full(void) {
+    reset();
+    g_pc_tx_next = 2 * TICK_NS; // 로그가 먼저 쌓인 뒤 요청 도착
+    for (uint32_t i = 0; i < 15; i++) pc_send((uint8_t)i, g_cmds[i % N_CMDS]);
+    run(1000000000ULL, log_burst);
+    CHECK_EQ(g_replies, 15);
+    for (uint32_t i = 0; i < 15; i++) CHECK_EQ(g_reply[i], BIN_STATUS_OK);
+    CHECK(g_bin.reply_waits > 0);
+    CHECK_EQ(g_tx.dropped, 0);          // 응답은 드롭으로 세지 않음 (보내지 않은 적이 없음)
+    CHECK_EQ(g_rx.overrun, 0);
+    CHECK_EQ(g_pc_rx_other, UART_TX_RING_SIZE - 3);
+    printf("  송신 버퍼 가득: 응답 15/15, 응답 대기 %u 번, 로그 드롭 %u\n",
+           (unsigned)g_bin.reply_waits, (unsigned)g_tx.dropped);
+
+    // 자리가 없으면 응답을 일부만 쓰지 않음
+    reset();
+    uart_tx_msg_t msg;
+    tx_msg_begin(&g_tx, &msg);
+    for (int i = 0; i < UART_TX_RING_SIZE - 4; i++) tx_msg_byte(&msg, 'x');
+    tx_msg_end(&msg);
+    uint16_t head = g_tx.head;
+    CHECK(!bin_send_reply(&g_tx, 1, BIN_STATUS_OK));
+    CHECK_EQ(g_tx.head, head);
+    CHECK_EQ(g_tx.dropped, 0);
+}
+
+int main(void) {
+    test_pipeline();
+    test_lost_byte();
+    test_corrupt_len();
+    test_crc();
+    test_tx_full();
+    return TEST_END();
+}
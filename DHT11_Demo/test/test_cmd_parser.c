@@ -0,0 +1,251 @@
+/***
+ cmd_parser (1바이트씩 해석하는 명령어 파서) 호스트 테스트 + 벤치마크
+ - 형식: 예제 명령어, 페이드 (F 뒤 숫자 없음은 오류), 여러 명령어 (;), 공백 / LF 무시, 숫자 고정 (65535), 오류 (TAIL 없음, 빈 명령어, 너무 긴 인자 ...)
+ - 벤치마크: 명령어 하나당 시간 (ns, PC), 종료 문자 1바이트 처리 시간 (중앙값 / 최소)
+   예전 경로 = 종료 문자까지 버퍼에 쌓고 strncmp("HDR") + strstr("TAIL") 두 번 + atoi / isdigit / strcmp (기준 커밋의 process_command 에서 해석 부분만)
+   새 경로   = 바이트마다 cmd_parser_feed()
+ ***/
+#include "test_util.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cmd_parser.h"
+
+static cmd_parser_t g_parser;
+
+// ■ 문자열 전체를 넣고, 종료 문자 결과 반환
+static cmd_result_t feed_str(const char *s) {
+    cmd_result_t result = CMD_RESULT_NONE;
+    while (*s != '\0') {
+        cmd_result_t r = cmd_parser_feed(&g_parser, (uint8_t)*s++);
+        if (r != CMD_RESULT_NONE) result = r;
+    }
+    return result;
+}
+
+static void test_format(void) {
+    cmd_parser_reset(&g_parser);
+
+    CHECK_EQ(feed_str("HDRR50TAIL\r"), CMD_RESULT_READY);
+    CHECK_EQ(g_parser.count, 1);
+    CHECK_EQ(g_parser.cmds[0].opcode, 'R');
+    CHECK_EQ(g_parser.cmds[0].value, 50);
+    CHECK(g_parser.cmds[0].has_value);
+    CHECK(!g_parser.cmds[0].has_fade);
+    CHECK_EQ(g_parser.cmds[0].word_len, 0);
+
+    CHECK_EQ(feed_str("HDRR50F2000TAIL\r"), CMD_RESULT_READY);
+    CHECK_EQ(g_parser.cmds[0].value, 50);
+    CHECK(g_parser.cmds[0].has_fade);
+    CHECK_EQ(g_parser.cmds[0].fade_ms, 2000);
+    CHECK_EQ(feed_str("HDRR50F0TAIL\r"), CMD_RESULT_READY);   // 0 ms 페이드는 숫자로 적었을 때만
+    CHECK(g_parser.cmds[0].has_fade);
+    CHECK_EQ(g_parser.cmds[0].fade_ms, 0);
+
+    CHECK_EQ(feed_str("HDRT10ONTAIL\r"), CMD_RESULT_READY);
+    CHECK_EQ(g_parser.cmds[0].opcode, 'T');
+    CHECK_EQ(g_parser.cmds[0].value, 10);
+    CHECK(strcmp(g_parser.cmds[0].word, "ON") == 0);
+
+    CHECK_EQ(feed_str("HDRT5OFFTAIL\r"), CMD_RESULT_READY);
+    CHECK(strcmp(g_parser.cmds[0].word, "OFF") == 0);
+
+    // 여러 명령어 + 공백, CR+LF
+    CHECK_EQ(feed_str("HDR R50;G10;B40 TAIL\r\n"), CMD_RESULT_READY);
+    CHECK_EQ(g_parser.count, 3);
+    CHECK_EQ(g_parser.cmds[1].opcode, 'G');
+    CHECK_EQ(g_parser.cmds[1].value, 10);
+    CHECK_EQ(g_parser.cmds[2].opcode, 'B');
+    CHECK_EQ(g_parser.cmds[2].value, 40);
+
+    // 인자 없음 / 문자 인자만 (TAIL 의 'T' 가 앞 글자와 겹치는 경우 포함)
+    CHECK_EQ(feed_str("HDRSTAIL\r"), CMD_RESULT_READY);
+    CHECK_EQ(g_parser.cmds[0].opcode, 'S');
+    CHECK(!g_parser.cmds[0].has_value);
+    CHECK_EQ(feed_str("HDRAONTAIL\r"), CMD_RESULT_READY);
+    CHECK(strcmp(g_parser.cmds[0].word, "ON") == 0);
+    CHECK_EQ(feed_str("HDRTTTAIL\r"), CMD_RESULT_READY);
+    CHECK_EQ(g_parser.cmds[0].opcode, 'T');
+    CHECK(strcmp(g_parser.cmds[0].word, "T") == 0);
+
+    // 숫자 고정
+    CHECK_EQ(feed_str("HDRR99999999TAIL\r"), CMD_RESULT_READY);
+    CHECK_EQ(g_parser.cmds[0].value, CMD_VALUE_MAX);
+
+    // 오류
+    CHECK_EQ(feed_str("HDRR50\r"), CMD_RESULT_ERROR);           // TAIL 없음
+    CHECK_EQ(feed_str("HDRTAIL\r"), CMD_RESULT_ERROR);          // 빈 명령어
+    CHECK_EQ(feed_str("XDRR50TAIL\r"), CMD_RESULT_ERROR);       // 헤더 틀림
+    CHECK_EQ(feed_str("HDRR50ABCDEFGHTAIL\r"), CMD_RESULT_ERROR); // 문자 인자 너무 김
+    CHECK_EQ(feed_str("HDRR1;R2;R3;R4;R5;R6;R7;R8;R9TAIL\r"), CMD_RESULT_ERROR); // 명령어 너무 많음
+    CHECK_EQ(feed_str("\r"), CMD_RESULT_ERROR);                 // 빈 줄
+    CHECK_EQ(feed_str("HDRR50FTAIL\r"), CMD_RESULT_ERROR);      // 'F' 뒤에 페이드 시간 없음
+    CHECK_EQ(feed_str("HDRR50F;G10TAIL\r"), CMD_RESULT_ERROR);  // (';' 앞)
+    CHECK_EQ(feed_str("HDRK6500FONTAIL\r"), CMD_RESULT_ERROR);  // (문자 인자 앞)
+
+    // 오류 뒤에도 다음 프레임은 정상
+    CHECK_EQ(feed_str("HDRB100TAIL\r"), CMD_RESULT_READY);
+    CHECK_EQ(g_parser.cmds[0].opcode, 'B');
+    CHECK_EQ(g_parser.cmds[0].value, 100);
+
+    // 종료 문자 전에는 결과 없음 (바이트마다 NONE)
+    CHECK_EQ(feed_str("HDRR5TAIL"), CMD_RESULT_NONE);
+    CHECK_EQ(cmd_parser_feed(&g_parser, '\r'), CMD_RESULT_READY);
+}
+
+/*** 예전 해석 방식 (기준 커밋 process_command 의 문자열 처리만 옮김, 실행 부분은 제외) ***/
+#define UART_RX_BUF_SIZE 30
+typedef struct {
+    char buffer[50];    // 예전 g_rx_buffer
+    uint8_t index;      // 예전 g_rx_index
+} old_rx_t;
+
+static old_rx_t g_old_rx;
+
+// ■ 예전 uart_callback: 종료 문자까지 버퍼에 쌓음
+static _Bool old_rx_byte(old_rx_t *rx, uint8_t c) {
+    rx->buffer[rx->index++] = (char)c;
+    if (c == END_CHARACTER || rx->index >= UART_RX_BUF_SIZE) {
+        rx->buffer[rx->index] = '\0';
+        rx->index = 0;
+        return true;
+    }
+    return false;
+}
+
+// ■ 예전 process_command: 해석 결과 (opcode + 값) 만 돌려줌
+static uint32_t old_parse(old_rx_t *rx) {
+    if (strncmp(rx->buffer, "HDR", 3) == 0 && strstr(rx->buffer, "TAIL") != NULL) {
+        char *start = rx->buffer + 3;
+        char *end = strstr(rx->buffer, "TAIL");
+        *end = '\0';
+        uint32_t value = 0;
+        switch (start[0]) {
+            case 'R': case 'G': case 'B':
+                value = (uint32_t)atoi(start + 1);
+                break;
+            case 'T': {
+                char temp[3] = {0};
+                int i = 1;
+                while (isdigit((unsigned char)start[i]) && i < 3) {
+                    temp[i - 1] = start[i];
+                    i++;
+                }
+                temp[i - 1] = '\0';
+                value = (uint32_t)atoi(temp);
+                if (strcmp(start + i, "ON") == 0) value |= 0x10000U;
+                else if (strcmp(start + i, "OFF") == 0) value |= 0x20000U;
+                for (i = 0; i < UART_RX_BUF_SIZE; i++) rx->buffer[i] = 0;
+                break;
+            }
+            case 'A':
+                if (strncmp(start + 1, "ON", 2) == 0) value = 1;
+                else if (strncmp(start + 1, "OFF", 3) == 0) value = 2;
+                break;
+            default:
+                break;
+        }
+        return ((uint32_t)(uint8_t)start[0] << 24) | value;
+    }
+    return 0;
+}
+
+/*** 종료 문자 > 해석 완료 시간 (키 입력 > PWM 변경 지연에 더해지는 부분) ***/
+// 파서 여러 개에 종료 문자 앞까지를 미리 넣어 두고 (시간 측정 밖), 종료 문자 1바이트 처리만 묶음으로 측정
+// 예전: 종료 문자 저장 + 버퍼 전체 재검색 + atoi, 상태 머신: cmd_parser_feed('\r')
+#define TERM_BATCH 256
+#define TERM_ROUNDS 2001
+
+static old_rx_t g_old_batch[TERM_BATCH];
+static cmd_parser_t g_parser_batch[TERM_BATCH];
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_terminator(const char **commands, const size_t *lens, unsigned n_cmds) {
+    static double old_ns[TERM_ROUNDS], new_ns[TERM_ROUNDS];
+    for (unsigned r = 0; r < TERM_ROUNDS; r++) {
+        // 준비: 종료 문자 앞까지 입력 (측정 밖)
+        for (unsigned k = 0; k < TERM_BATCH; k++) {
+            const char *s = commands[(k * 5U + r) % n_cmds];
+            size_t len = lens[(k * 5U + r) % n_cmds] - 1;
+            g_old_batch[k].index = 0;
+            cmd_parser_reset(&g_parser_batch[k]);
+            for (size_t i = 0; i < len; i++) {
+                (void)old_rx_byte(&g_old_batch[k], (uint8_t)s[i]);
+                (void)cmd_parser_feed(&g_parser_batch[k], (uint8_t)s[i]);
+            }
+        }
+        uint64_t t0 = now_ns();
+        for (unsigned k = 0; k < TERM_BATCH; k++) {
+            if (old_rx_byte(&g_old_batch[k], END_CHARACTER)) g_test_sink += old_parse(&g_old_batch[k]);
+        }
+        uint64_t t1 = now_ns();
+        for (unsigned k = 0; k < TERM_BATCH; k++) {
+            if (cmd_parser_feed(&g_parser_batch[k], END_CHARACTER) == CMD_RESULT_READY) {
+                g_test_sink += g_parser_batch[k].cmds[0].value + g_parser_batch[k].cmds[0].opcode;
+            }
+        }
+        uint64_t t2 = now_ns();
+        old_ns[r] = (double)(t1 - t0) / TERM_BATCH;
+        new_ns[r] = (double)(t2 - t1) / TERM_BATCH;
+    }
+    qsort(old_ns, TERM_ROUNDS, sizeof(old_ns[0]), compare_double);
+    qsort(new_ns, TERM_ROUNDS, sizeof(new_ns[0]), compare_double);
+    printf("  종료 문자 > 해석 완료 (중앙값 / 최소): 예전 %.1f / %.1f ns (버퍼 재검색 + atoi), 상태 머신 %.1f / %.1f ns\n",
+           old_ns[TERM_ROUNDS / 2], old_ns[0], new_ns[TERM_ROUNDS / 2], new_ns[0]);
+}
+
+static void bench(void) {
+    static const char *commands[] = {
+        "HDRR50TAIL\r", "HDRG100TAIL\r", "HDRB7TAIL\r", "HDRT10ONTAIL\r",
+        "HDRT5OFFTAIL\r", "HDRAONTAIL\r", "HDRAOFFTAIL\r", "HDRR255TAIL\r",
+    };
+    const unsigned n_cmds = sizeof(commands) / sizeof(commands[0]);
+    size_t lens[8];
+    size_t bytes = 0;
+    for (unsigned i = 0; i < n_cmds; i++) {
+        lens[i] = strlen(commands[i]);
+        bytes += lens[i];
+    }
+    const uint32_t reps = 500000;
+
+    uint64_t t0 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) {
+        for (unsigned i = 0; i < n_cmds; i++) {
+            const char *s = commands[i];
+            for (size_t k = 0; k < lens[i]; k++) {
+                if (old_rx_byte(&g_old_rx, (uint8_t)s[k])) g_test_sink += old_parse(&g_old_rx);
+            }
+        }
+    }
+    uint64_t t1 = now_ns();
+    cmd_parser_reset(&g_parser);
+    for (uint32_t r = 0; r < reps; r++) {
+        for (unsigned i = 0; i < n_cmds; i++) {
+            const char *s = commands[i];
+            for (size_t k = 0; k < lens[i]; k++) {
+                if (cmd_parser_feed(&g_parser, (uint8_t)s[k]) == CMD_RESULT_READY) {
+                    g_test_sink += g_parser.cmds[0].value + g_parser.cmds[0].opcode;
+                }
+            }
+        }
+    }
+    uint64_t t2 = now_ns();
+
+    double old_ns = (double)(t1 - t0) / ((double)reps * n_cmds);
+    double new_ns = (double)(t2 - t1) / ((double)reps * n_cmds);
+    double per_byte = (double)(t2 - t1) / ((double)reps * (double)bytes);
+    printf("  명령어 하나 (평균 %.1f 바이트): 예전 %.1f ns, 상태 머신 %.1f ns (바이트당 %.1f ns)\n",
+           (double)bytes / n_cmds, old_ns, new_ns, per_byte);
+
+    bench_terminator(commands, lens, n_cmds);
+}
+
+int main(void) {
+    test_format();
+    bench();
+    return TEST_END();
+}
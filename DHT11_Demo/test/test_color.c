@@ -0,0 +1,165 @@
+/***
+ color (정수 HSV / 색온도 변환) 호스트 테스트 + 벤치마크
+ - HSV: 색상 0 ~ 359 (+ 360 이상 나머지), 채도 / 밝기 0 ~ 100 모든 조합을 double 기준식과 비교
+   가장 밝은 채널 = 밝기, 채도 0 이면 회색 (세 채널 같음)
+ - 색온도: 1000 ~ 10000K (1K 간격), 밝기 0 ~ 100 을 tools/cct_table.py 와 같은 식 (Tanner Helland, double) 과 비교
+   범위 밖 색온도는 끝값
+ - 벤치마크: 정수 HSV / float HSV 변환 1번 (PC)
+ ***/
+#include "test_util.h"
+#include <math.h>
+#include <stdlib.h>
+#include "color.h"
+#include "cct_table.h"
+
+// ■ HSV > RGB 기준식 (double, 0 ~ COLOR_ONE)
+static void ref_hsv(double h, double s, double v, double rgb[3]) {
+    h = fmod(h, 360.0);
+    double c = v * s;
+    double x = c * (1.0 - fabs(fmod(h / 60.0, 2.0) - 1.0));
+    double m = v - c;
+    double r, g, b;
+    if (h < 60)       { r = c; g = x; b = 0; }
+    else if (h < 120) { r = x; g = c; b = 0; }
+    else if (h < 180) { r = 0; g = c; b = x; }
+    else if (h < 240) { r = 0; g = x; b = c; }
+    else if (h < 300) { r = x; g = 0; b = c; }
+    else              { r = c; g = 0; b = x; }
+    rgb[0] = (r + m) * COLOR_ONE;
+    rgb[1] = (g + m) * COLOR_ONE;
+    rgb[2] = (b + m) * COLOR_ONE;
+}
+
+// ■ 색온도 > RGB 기준식 (tools/cct_table.py cct_to_rgb 와 같음, 0.0 ~ 1.0)
+static void ref_cct(double kelvin, double rgb[3]) {
+    double t = kelvin / 100.0;
+    double r, g, b;
+    if (t <= 66) {
+        r = 255.0;
+        g = 99.4708025861 * log(t) - 161.1195681661;
+    }
+    else {
+        r = 329.698727446 * pow(t - 60, -0.1332047592);
+        g = 288.1221695283 * pow(t - 60, -0.0755148492);
+    }
+    if (t >= 66) b = 255.0;
+    else if (t <= 19) b = 0.0;
+    else b = 138.5177312231 * log(t - 10) - 305.0447927307;
+    rgb[0] = fmin(fmax(r, 0.0), 255.0) / 255.0;
+    rgb[1] = fmin(fmax(g, 0.0), 255.0) / 255.0;
+    rgb[2] = fmin(fmax(b, 0.0), 255.0) / 255.0;
+}
+
+static void test_hsv(void) {
+    double max_err = 0;
+    uint32_t bad_max = 0, bad_gray = 0;
+    for (uint16_t hue = 0; hue < 720; hue++) {
+        for (uint8_t sat = 0; sat <= 100; sat++) {
+            for (uint8_t val = 0; val <= 100; val++) {
+                color_rgb_t c;
+                double ref[3];
+                color_hsv_to_rgb(hue, sat, val, &c);
+                ref_hsv(hue, sat / 100.0, val / 100.0, ref);
+                const uint16_t got[3] = { c.r, c.g, c.b };
+                uint16_t top = 0;
+                for (int ch = 0; ch < 3; ch++) {
+                    double err = fabs(got[ch] - ref[ch]);
+                    if (err > max_err) max_err = err;
+                    if (got[ch] > top) top = got[ch];
+                }
+                if (top != (uint16_t)((val * COLOR_ONE + 50) / 100)) bad_max++;
+                if (sat == 0 && (c.r != c.g || c.g != c.b)) bad_gray++;
+            }
+        }
+    }
+    CHECK(max_err <= 2.0);
+    CHECK_EQ(bad_max, 0);
+    CHECK_EQ(bad_gray, 0);
+    printf("  HSV: 최대 오차 %.2f / %d\n", max_err, COLOR_ONE);
+}
+
+static void test_cct(void) {
+    double max_err = 0, max_err_k = 0, band_err = 0;
+    for (uint16_t k = CCT_TABLE_MIN_K; k <= CCT_TABLE_MAX_K; k++) {
+        for (uint8_t val = 0; val <= 100; val += 10) {
+            color_rgb_t c;
+            double ref[3];
+            color_cct_to_rgb(k, val, &c);
+            ref_cct(k, ref);
+            const uint16_t got[3] = { c.r, c.g, c.b };
+            for (int ch = 0; ch < 3; ch++) {
+                double err = fabs(got[ch] - ref[ch] * COLOR_ONE * val / 100.0);
+                if (k > 6500 && k < 6700) { if (err > band_err) band_err = err; }
+                else if (err > max_err) { max_err = err; max_err_k = k; }
+            }
+        }
+    }
+    // 100K 간격 선형 보간 오차, 6500 ~ 6700K 는 기준식 자체가 6600K 에서 끊김 (녹색 255 > 251.6, 청색 252.5 > 255)
+    double jump = 0;
+    double below[3], above[3];
+    ref_cct(6600.0, below);
+    ref_cct(6601.0, above);
+    for (int ch = 0; ch < 3; ch++) if (fabs(below[ch] - above[ch]) * COLOR_ONE > jump) jump = fabs(below[ch] - above[ch]) * COLOR_ONE;
+    CHECK(max_err <= 10.0);
+    CHECK(band_err <= jump + 10.0);
+    printf("  색온도: 최대 오차 %.1f / %d (%.0fK), 6500 ~ 6700K %.1f (기준식 끊김 %.1f)\n",
+           max_err, COLOR_ONE, max_err_k, band_err, jump);
+
+    color_rgb_t lo, lo_clamped, hi, hi_clamped;
+    color_cct_to_rgb(CCT_TABLE_MIN_K, 100, &lo);
+    color_cct_to_rgb(500, 100, &lo_clamped);
+    color_cct_to_rgb(CCT_TABLE_MAX_K, 100, &hi);
+    color_cct_to_rgb(20000, 100, &hi_clamped);
+    CHECK(lo.r == lo_clamped.r && lo.g == lo_clamped.g && lo.b == lo_clamped.b);
+    CHECK(hi.r == hi_clamped.r && hi.g == hi_clamped.g && hi.b == hi_clamped.b);
+}
+
+// ■ float 기준 (비교용, 보드에서 쓰면 단정도 FPU)
+static void float_hsv(uint16_t hue, uint8_t sat, uint8_t val, color_rgb_t *out) {
+    float h = (float)(hue % 360U), s = (float)sat / 100.0f, v = (float)val / 100.0f;
+    float c = v * s;
+    float x = c * (1.0f - fabsf(fmodf(h / 60.0f, 2.0f) - 1.0f));
+    float m = v - c;
+    float r, g, b;
+    switch ((int)(h / 60.0f)) {
+        case 0:  r = c; g = x; b = 0; break;
+        case 1:  r = x; g = c; b = 0; break;
+        case 2:  r = 0; g = c; b = x; break;
+        case 3:  r = 0; g = x; b = c; break;
+        case 4:  r = x; g = 0; b = c; break;
+        default: r = c; g = 0; b = x; break;
+    }
+    out->r = (uint16_t)lroundf((r + m) * COLOR_ONE);
+    out->g = (uint16_t)lroundf((g + m) * COLOR_ONE);
+    out->b = (uint16_t)lroundf((b + m) * COLOR_ONE);
+}
+
+static void bench(void) {
+    const uint32_t reps = 3000000;
+    color_rgb_t c;
+    uint64_t t0 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) {
+        color_hsv_to_rgb((uint16_t)((r + g_test_sink) % 360U), (uint8_t)(r % 101U), 80, &c);
+        g_test_sink += (uint32_t)c.r + c.g + c.b;
+    }
+    uint64_t t1 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) {
+        float_hsv((uint16_t)((r + g_test_sink) % 360U), (uint8_t)(r % 101U), 80, &c);
+        g_test_sink += (uint32_t)c.r + c.g + c.b;
+    }
+    uint64_t t2 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) {
+        color_cct_to_rgb((uint16_t)(1000U + (r + g_test_sink) % 9001U), 80, &c);
+        g_test_sink += (uint32_t)c.r + c.g + c.b;
+    }
+    uint64_t t3 = now_ns();
+    printf("  변환 1번: 정수 HSV %.1f ns, float HSV %.1f ns, 정수 색온도 %.1f ns (PC)\n",
+           (double)(t1 - t0) / reps, (double)(t2 - t1) / reps, (double)(t3 - t2) / reps);
+}
+
+int main(void) {
+    test_hsv();
+    test_cct();
+    bench();
+    return TEST_END();
+}
@@ -0,0 +1,59 @@
+/***
+ gamma_table.h (감마 보정 테이블) 호스트 확인 + 벤치마크
+ - 1001 칸 모두 기준 커밋의 pow() 계산 (gamma_correct_duty_cycle) 과 같은 값인지
+ - 0 > 0, 주기 > 주기, 단조 증가 (밝기 단계가 거꾸로 가지 않음)
+ - 벤치마크: pow() 1번 (double) / 테이블 1번 읽기 (PC)
+ ***/
+#include "test_util.h"
+#include <math.h>
+#include "gamma_table.h"
+
+#define RGB_PWM_PERIOD GAMMA_TABLE_PERIOD
+#define GAMMA GAMMA_TABLE_GAMMA
+
+static const uint16_t g_gamma_table[GAMMA_TABLE_PERIOD + 1] = { GAMMA_TABLE_VALUES };
+
+// ■ 기준 커밋 hal_entry.c 의 gamma_correct_duty_cycle() 그대로
+static uint32_t gamma_pow(uint32_t duty_cycle) {
+    double normalized_duty_cycle = (double)duty_cycle / RGB_PWM_PERIOD;
+    double corrected_intensity = pow(normalized_duty_cycle, 1/GAMMA);
+    uint32_t corrected_duty_cycle = (uint32_t)(corrected_intensity * RGB_PWM_PERIOD);
+    return corrected_duty_cycle;
+}
+
+static void test_table(void) {
+    uint32_t bad = 0, not_monotonic = 0;
+    for (uint32_t d = 0; d <= GAMMA_TABLE_PERIOD; d++) {
+        if (g_gamma_table[d] != gamma_pow(d)) {
+            if (bad < 5) printf("  다름: d=%u 테이블 %u, pow %u\n", d, g_gamma_table[d], gamma_pow(d));
+            bad++;
+        }
+        if (d > 0 && g_gamma_table[d] < g_gamma_table[d - 1]) not_monotonic++;
+    }
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(not_monotonic, 0);
+    CHECK_EQ(g_gamma_table[0], 0);
+    CHECK_EQ(g_gamma_table[GAMMA_TABLE_PERIOD], GAMMA_TABLE_PERIOD);
+}
+
+static void bench(void) {
+    const uint32_t reps = 2000;
+    uint64_t t0 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) {
+        for (uint32_t d = 0; d <= GAMMA_TABLE_PERIOD; d++) g_test_sink += gamma_pow((d + g_test_sink) % (GAMMA_TABLE_PERIOD + 1));
+    }
+    uint64_t t1 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) {
+        for (uint32_t d = 0; d <= GAMMA_TABLE_PERIOD; d++) g_test_sink += g_gamma_table[(d + g_test_sink) % (GAMMA_TABLE_PERIOD + 1)];
+    }
+    uint64_t t2 = now_ns();
+    double n = (double)reps * (GAMMA_TABLE_PERIOD + 1);
+    printf("  감마 보정 1번: pow() %.1f ns, 테이블 %.1f ns (PC, 하드웨어 double 있음; RA4M2 는 double 이 소프트웨어)\n",
+           (double)(t1 - t0) / n, (double)(t2 - t1) / n);
+}
+
+int main(void) {
+    test_table();
+    bench();
+    return TEST_END();
+}
@@ -0,0 +1,174 @@
+/***
+ led_timer (ON/OFF 예약 카운트다운 태스크) 호스트 테스트, 가상 시간 (1 ms 틱)
+ - 실제 task.c / timer_wheel.c / led_timer.c 를 그대로 사용, 메인 루프 디스패치는 이벤트가 올라온 뒤 무작위로 늦게
+   (0 ~ D ms, 다른 처리 / 긴 명령어 출력 등으로 메인 루프가 바쁜 상황)
+ - 확인: k 번째 1초 출력과 만료 시각 = 예약 시각 + k 초 + (0 ~ D + 1 틱), 늦어져도 다음 초로 누적되지 않음
+         남은 초는 빠짐 / 중복 없이 1씩 감소, 틱 카운터 32비트 넘어감, 새 예약 (처음부터), 취소 (만료 없음)
+ - 비교: 깨어날 때마다 1초 상대 대기 (TASK_SLEEP 1000) 하는 카운트다운은 지연이 누적됨
+ ***/
+#include "test_util.h"
+#include <stdlib.h>
+#include <string.h>
+#include "led_timer.h"
+
+#define TICK_HZ 1000U
+#define EV_TASK  (1UL << 0)
+#define EV_SET   (1UL << 1)
+#define EV_RESET (1UL << 2)
+
+static timer_wheel_t g_wheel;
+static led_timer_task_t g_lt;
+static uint32_t g_pending;          // 올라온 이벤트 (event_post)
+static uint32_t g_dispatch_at;      // 메인 루프가 이벤트를 처리하는 틱
+static _Bool g_dispatch_armed;
+static uint32_t g_delay_max;        // 디스패치 최대 지연 (틱)
+
+static uint32_t g_load_tick;        // 예약을 불러온 틱 (카운트다운 기준)
+static uint32_t g_expected;         // 다음 on_second 에서 기대하는 남은 초
+static uint32_t g_seconds;          // on_second 호출 수
+static uint32_t g_bad_count;        // 남은 초가 1씩 줄지 않음
+static uint32_t g_late_min, g_late_max;
+static uint32_t g_expired;
+static uint32_t g_expire_late;
+
+static void post(uint32_t events) {
+    g_pending |= events;
+    if (!g_dispatch_armed) {
+        g_dispatch_armed = true;
+        g_dispatch_at = g_wheel.now + (g_delay_max ? (uint32_t)rand() % (g_delay_max + 1U) : 0U);
+    }
+}
+
+static void on_second(uint32_t remaining) {
+    if (remaining != g_expected) g_bad_count++;
+    g_expected = remaining - 1U;
+    g_seconds++;
+    uint32_t due = g_load_tick + (g_lt.minutes * 60U - remaining) * TICK_HZ;
+    uint32_t late = g_wheel.now - due;
+    if (late < g_late_min) g_late_min = late;
+    if (late > g_late_max) g_late_max = late;
+}
+
+static void on_expire(void) {
+    g_expired++;
+    g_expire_late = g_wheel.now - (g_load_tick + g_lt.minutes * 60U * TICK_HZ);
+}
+
+// ■ 비교용: 깨어날 때마다 1초 상대 대기
+typedef struct {
+    task_t task;
+    uint32_t remaining;
+    uint32_t start;
+    uint32_t end;
+} naive_task_t;
+static naive_task_t g_naive;
+
+static uint8_t naive_task(task_t *t) {
+    naive_task_t *n = (naive_task_t *)t;
+    TASK_BEGIN(t);
+    TASK_AWAIT(t, EV_SET);
+    n->start = task_now();
+    while (n->remaining > 0) {
+        TASK_SLEEP(t, TICK_HZ);
+        n->remaining--;
+    }
+    n->end = task_now();
+    TASK_END(t);
+}
+
+static task_t *const g_tasks[] = { &g_lt.task, &g_naive.task };
+
+// ■ 1 틱 진행: 시스템 틱 (타이머 휠) > 메인 루프 (디스패치 시각이 됐으면)
+static void step(void) {
+    tw_tick(&g_wheel);
+    if (g_dispatch_armed && (int32_t)(g_wheel.now - g_dispatch_at) >= 0) {
+        uint32_t events = g_pending;
+        g_pending = 0;
+        g_dispatch_armed = false;
+        _Bool loading = (events & EV_SET) != 0;
+        task_dispatch(g_tasks, 2, events);
+        if (loading) {
+            g_load_tick = g_lt.deadline - TICK_HZ;
+            g_expected = g_lt.minutes * 60U - 1U;
+        }
+    }
+}
+
+static void setup(uint32_t start_tick, uint32_t delay_max) {
+    tw_init(&g_wheel, start_tick);
+    g_pending = 0;
+    g_dispatch_armed = false;
+    g_delay_max = delay_max;
+    task_sched_init(&g_wheel, post, EV_TASK);
+    led_timer_init(&g_lt, EV_SET, EV_RESET, TICK_HZ, on_second, on_expire);
+    memset(&g_naive, 0, sizeof(g_naive));
+    task_init(&g_naive.task, naive_task);
+    g_seconds = g_bad_count = g_expired = 0;
+    g_late_min = UINT32_MAX;
+    g_late_max = 0;
+    while (g_dispatch_armed) step();     // 태스크 시작 (대기 상태로, 그 전에 온 이벤트는 받지 못함)
+}
+
+static void run_ticks(uint32_t ticks) {
+    for (uint32_t i = 0; i < ticks; i++) step();
+}
+
+// ■ 예약 minutes 분, 디스패치 지연 최대 delay_max 틱
+static void test_accuracy(uint32_t start_tick, uint32_t delay_max, uint32_t minutes) {
+    setup(start_tick, delay_max);
+    led_timer_set(&g_lt, minutes);
+    g_naive.remaining = minutes * 60U;
+    post(EV_SET);
+    run_ticks(minutes * 60U * TICK_HZ + 2U * delay_max + 10U);
+    run_ticks(minutes * 60U * delay_max + 10U);  // 상대 대기 카운트다운이 끝날 때까지 (초마다 최대 delay_max + 1 늦음)
+
+    CHECK_EQ(g_seconds, minutes * 60U);
+    CHECK_EQ(g_bad_count, 0);
+    CHECK_EQ(g_expired, 1);
+    CHECK(!g_lt.active);
+    CHECK(g_late_max <= delay_max + 1U);
+    CHECK(g_expire_late <= delay_max + 1U);
+    uint32_t naive_drift = g_naive.end - g_naive.start - minutes * 60U * TICK_HZ;
+    if (delay_max > 0) CHECK(naive_drift > g_late_max); // 상대 대기는 누적
+    printf("  %u 분, 지연 0 ~ %3u ms%s: 1초 출력 늦음 %u ~ %u ms, 만료 늦음 %u ms | 상대 대기 누적 %u ms\n",
+           (unsigned)minutes, (unsigned)delay_max, (start_tick > 0xF0000000U) ? " (틱 넘어감)" : "",
+           (unsigned)g_late_min, (unsigned)g_late_max, (unsigned)g_expire_late, (unsigned)naive_drift);
+}
+
+// ■ 카운트다운 중 새 예약 > 그 시각부터 다시, 취소 > 만료 없음
+static void test_reset(void) {
+    setup(0, 20);
+    led_timer_set(&g_lt, 1);
+    post(EV_SET);
+    run_ticks(25500);                       // 25초쯤
+    CHECK(g_lt.active);
+    led_timer_set(&g_lt, 2);
+    post(EV_SET);
+    g_seconds = 0;
+    run_ticks(120U * TICK_HZ + 100U);
+    CHECK_EQ(g_seconds, 120);               // 새 예약 2분만큼 (이전 예약의 남은 초 없음)
+    CHECK_EQ(g_bad_count, 0);
+    CHECK_EQ(g_expired, 1);
+    CHECK(g_expire_late <= 21);
+
+    setup(0, 20);
+    led_timer_set(&g_lt, 1);
+    post(EV_SET);
+    run_ticks(30000);
+    post(EV_RESET);
+    run_ticks(60000);
+    CHECK_EQ(g_expired, 0);
+    CHECK(!g_lt.active);
+    CHECK(g_seconds >= 29 && g_seconds <= 30);
+}
+
+int main(void) {
+    srand(21);
+    test_accuracy(0, 0, 1);
+    test_accuracy(0, 5, 3);
+    test_accuracy(0, 50, 3);
+    test_accuracy(0, 900, 3);                // 거의 1초 늦게 디스패치
+    test_accuracy(0xFFFFFFFFU - 60000U, 50, 2); // 틱 카운터가 도중에 넘어감
+    test_reset();
+    return TEST_END();
+}
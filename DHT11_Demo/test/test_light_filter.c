@@ -0,0 +1,155 @@
+/***
+ light_filter (조도센서 Q31 필터) 호스트 테스트 + 벤치마크 (실제 계수 light_filter_coeffs.h)
+ - 차가운 시작 (상태 0): 0 ~ 4095 모든 값, 오버샘플링 1/2/4/16 배 > Q31 출력이 넘어가지 않고 (부호 유지),
+   12비트 출력이 값 ± 1 로 수렴
+ - 계단 입력 (0 <> 4095, 무작위 값 사이): 넘어감 없음, 6블록 (600ms) 안에 수렴
+ - 120Hz 조명 깜빡임 (진폭 1000): 출력 흔들림 ± 2 이하
+ - 여유 비트: 스테이지마다 최대 |출력| / 입력 최댓값 > 이전 시프트 19 (여유 0비트) 였다면 Q31 을 넘었는지
+ - 포화: C 코드 biquad 가 넘어가는 대신 포화하는지
+ - 벤치마크: C 코드 블록 하나 처리 시간 (PC), MACL 은 보드에서 명령어 Q 로 비교
+ ***/
+#include "test_util.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "light_filter.h"
+
+static light_filter_t g_lf;
+static uint16_t g_block[ADC_BLOCK_SIZE];
+static const uint8_t g_scale_log2[] = { 0, 1, 2, 4 };   // 오버샘플링 1, 2, 4, 16 회 덧셈
+
+// ■ 같은 값 블록 하나 (12비트 값 x 오버샘플링 배수)
+static uint16_t feed_const(uint32_t level, uint8_t scale_log2) {
+    for (uint32_t i = 0; i < ADC_BLOCK_SIZE; i++) g_block[i] = (uint16_t)(level << scale_log2);
+    return light_filter_process(&g_lf, g_block, scale_log2);
+}
+
+// ■ Q31 출력이 넘어가지 않았는지 (넘어가면 부호가 바뀌어 큰 음수 / 엉뚱한 값)
+static _Bool out_sane(uint32_t from, uint32_t to) {
+    int64_t lo = (int64_t)((from < to) ? from : to) << LIGHT_FILTER_Q31_SHIFT;
+    int64_t hi = (int64_t)((from > to) ? from : to) << LIGHT_FILTER_Q31_SHIFT;
+    int64_t margin = (hi - lo) / 4 + (1 << LIGHT_FILTER_Q31_SHIFT); // 과도응답 오버슈트 (25%) 까지
+    return g_lf.out >= lo - margin && g_lf.out <= hi + margin;
+}
+
+static void test_cold_start(void) {
+    for (unsigned m = 0; m < sizeof(g_scale_log2); m++) {
+        uint32_t bad_wrap = 0, bad_settle = 0;
+        for (uint32_t level = 0; level <= 4095; level++) {
+            light_filter_init(&g_lf);
+            uint16_t y = 0;
+            for (int b = 0; b < 8; b++) {
+                y = feed_const(level, g_scale_log2[m]);
+                if (!out_sane(0, level)) bad_wrap++;
+            }
+            if (abs((int)y - (int)level) > 1) bad_settle++;
+        }
+        CHECK_EQ(bad_wrap, 0);
+        CHECK_EQ(bad_settle, 0);
+    }
+}
+
+static void test_steps(void) {
+    srand(5);
+    for (unsigned m = 0; m < sizeof(g_scale_log2); m++) {
+        light_filter_init(&g_lf);
+        uint32_t level = 0, bad_wrap = 0, bad_settle = 0;
+        for (int step = 0; step < 400; step++) {
+            uint32_t next;
+            if (step < 8) next = (step & 1) ? 0 : 4095;  // 양 끝 계단
+            else next = (uint32_t)(rand() % 4096);
+            uint16_t y = 0;
+            for (int b = 0; b < 6; b++) {
+                y = feed_const(next, g_scale_log2[m]);
+                if (!out_sane(level, next)) bad_wrap++;
+            }
+            if (abs((int)y - (int)next) > 1) bad_settle++;
+            level = next;
+        }
+        CHECK_EQ(bad_wrap, 0);
+        CHECK_EQ(bad_settle, 0);
+    }
+}
+
+static void test_flicker(void) {
+    const double pi = 3.14159265358979323846;
+    for (unsigned m = 0; m < sizeof(g_scale_log2); m++) {
+        light_filter_init(&g_lf);
+        uint32_t n = 0;
+        int max_dev = 0;
+        for (int b = 0; b < 40; b++) {
+            for (uint32_t i = 0; i < ADC_BLOCK_SIZE; i++, n++) {
+                double v = 2000.0 + 1000.0 * sin(2.0 * pi * 120.0 * n / LIGHT_FILTER_FS_HZ + 0.3);
+                g_block[i] = (uint16_t)((uint32_t)lround(v) << g_scale_log2[m]);
+            }
+            uint16_t y = light_filter_process(&g_lf, g_block, g_scale_log2[m]);
+            if (b >= 8 && abs((int)y - 2000) > max_dev) max_dev = abs((int)y - 2000);
+        }
+        CHECK(max_dev <= 2);
+        if (m == 0) printf("  120Hz 깜빡임 (2000 ± 1000): 출력 흔들림 최대 ± %d\n", max_dev);
+    }
+}
+
+// ■ 스테이지마다 가장 큰 |출력| (입력 4095 << 17 기준 배수): 0 <> 4095 계단 반복
+static void test_headroom(void) {
+    q31_t state[4 * LIGHT_FILTER_BIQUAD_STAGES] = {0};
+    q31_t buf[ADC_BLOCK_SIZE];
+    double peak[LIGHT_FILTER_BIQUAD_STAGES] = {0};
+    const double full = (double)(4095U << LIGHT_FILTER_Q31_SHIFT);
+    for (int step = 0; step < 20; step++) {
+        uint32_t level = (step & 1) ? 0 : 4095;
+        for (int b = 0; b < 5; b++) {
+            for (uint32_t i = 0; i < ADC_BLOCK_SIZE; i++) buf[i] = (q31_t)(level << LIGHT_FILTER_Q31_SHIFT);
+            for (int s = 0; s < LIGHT_FILTER_BIQUAD_STAGES; s++) {
+                q31_biquad_df1_c(&g_light_biquad_coeffs[5 * s], &state[4 * s], 1, LIGHT_FILTER_POST_SHIFT,
+                                 buf, buf, ADC_BLOCK_SIZE);
+                for (uint32_t i = 0; i < ADC_BLOCK_SIZE; i++) {
+                    double v = fabs((double)buf[i]) / full;
+                    if (v > peak[s]) peak[s] = v;
+                }
+            }
+        }
+    }
+    double worst = 0;
+    for (int s = 0; s < LIGHT_FILTER_BIQUAD_STAGES; s++) if (peak[s] > worst) worst = peak[s];
+    printf("  최대 |출력| / 입력 최댓값: 노치 %.3f, 저역통과 %.3f > 시프트 19 였다면 %.3f x 2^31 (1 이상이면 넘어감)\n",
+           peak[0], peak[1], worst * (double)(4095U << 19) / 2147483648.0);
+    CHECK(worst * (double)(4095U << 19) > 2147483647.0);            // 이전 설정 (여유 없음) 은 넘어갔음
+    CHECK(worst * full < 2147483647.0 / 2);                         // 지금은 1비트 이상 남음
+}
+
+static void test_saturation(void) {
+    // 이득 2 (b0 = 0.5 x 2^post_shift 2) 에 최대 입력 > 포화 (넘어가면 음수)
+    static const q31_t coeffs[5] = { 1 << 30, 0, 0, 0, 0 };
+    q31_t state[4] = {0};
+    q31_t buf[4] = { INT32_MAX, INT32_MIN, 1 << 29, -(1 << 29) };
+    q31_biquad_df1_c(coeffs, state, 1, 2, buf, buf, 4);
+    CHECK_EQ(buf[0], INT32_MAX);
+    CHECK_EQ(buf[1], INT32_MIN);
+    CHECK_EQ(buf[2], 1 << 30);
+    CHECK_EQ(buf[3], -(1 << 30));
+}
+
+static void bench(void) {
+    light_filter_init(&g_lf);
+    for (uint32_t i = 0; i < ADC_BLOCK_SIZE; i++) g_block[i] = (uint16_t)(2048U + (i & 7U) * 64U);
+    const uint32_t reps = 200000;
+    uint64_t t0 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) {
+        g_block[r & (ADC_BLOCK_SIZE - 1)] ^= 1;
+        g_test_sink += light_filter_process(&g_lf, g_block, 0);
+    }
+    uint64_t t1 = now_ns();
+    printf("  C 코드 블록 하나 (biquad %d단 x %d + FIR %d탭): %.0f ns (PC)\n", LIGHT_FILTER_BIQUAD_STAGES,
+           ADC_BLOCK_SIZE, LIGHT_FILTER_FIR_TAPS, (double)(t1 - t0) / reps);
+}
+
+int main(void) {
+    test_cold_start();
+    test_steps();
+    test_flicker();
+    test_headroom();
+    test_saturation();
+    bench();
+    return TEST_END();
+}
@@ -0,0 +1,114 @@
+/***
+ rgb_dither (1차 시그마-델타) 호스트 시뮬레이션
+ - 모든 fine 값 0 ~ 64000 (1000 카운트 x 64): N 주기 (64 / 256 / 1000) 평균 듀티와 fine / 64 의 차이 (카운트)
+   디더링 OFF (반올림) 와 비교
+ - 주기마다 출력은 base 또는 base + 1 카운트만, 0 / 최댓값은 그대로
+ - 정수 카운트 (소수 부분 0): 누적 오차가 어떤 값이든 출력은 늘 반올림 값 그대로, 누적 오차도 그대로
+   > 세 채널 모두 정수면 인터럽트를 끄고 반올림 값을 바로 써도 같은 출력 (hal_entry.c rgb_output_fine)
+ - 페이드 (주기마다 fine 이 바뀜): 지금까지 출력한 카운트 합과 fine 합의 차이가 늘 1 카운트 미만
+ - 벤치마크: 세 채널 한 주기 (PC, 보드에서는 100kHz 인터럽트 안)
+ ***/
+#include "test_util.h"
+#include <math.h>
+#include <stdlib.h>
+#include "rgb_dither.h"
+
+#define PWM_PERIOD 1000U                       // RGB_PWM_PERIOD (hal_entry.c)
+#define FINE_MAX RGB_FINE(PWM_PERIOD)
+
+// ■ fine 값 하나를 periods 주기 출력한 평균 듀티 오차 (카운트), 주기마다 base / base + 1 만 나오는지
+static double avg_error(uint32_t fine, uint32_t periods, uint32_t *bad_level) {
+    uint32_t acc = 0, sum = 0;
+    uint32_t base = fine >> RGB_DITHER_BITS;
+    for (uint32_t p = 0; p < periods; p++) {
+        uint32_t counts = rgb_dither_next(&acc, fine);
+        if (counts != base && counts != base + 1U) (*bad_level)++;
+        sum += counts;
+    }
+    return fabs((double)sum / periods - (double)fine / (1U << RGB_DITHER_BITS));
+}
+
+static void test_static(void) {
+    static const uint32_t periods[] = { 64, 256, 1000 };
+    double round_err = 0;
+    for (uint32_t fine = 0; fine <= FINE_MAX; fine++) {
+        double e = fabs((double)RGB_FINE_ROUND(fine) - (double)fine / (1U << RGB_DITHER_BITS));
+        if (e > round_err) round_err = e;
+    }
+    printf("  평균 듀티 최대 오차 (카운트): 디더링 OFF (반올림) %.3f", round_err);
+    for (unsigned i = 0; i < sizeof(periods) / sizeof(periods[0]); i++) {
+        double max_err = 0;
+        uint32_t bad_level = 0;
+        for (uint32_t fine = 0; fine <= FINE_MAX; fine++) {
+            double e = avg_error(fine, periods[i], &bad_level);
+            if (e > max_err) max_err = e;
+        }
+        CHECK_EQ(bad_level, 0);
+        CHECK(max_err <= 1.0 / periods[i] + 1e-12);     // 오차 1/N 카운트 이하
+        if (periods[i] % (1U << RGB_DITHER_BITS) == 0) CHECK(max_err < 1e-12); // 64 의 배수 주기면 정확
+        printf(", %u 주기 %.2e", (unsigned)periods[i], max_err);
+    }
+    printf("\n");
+
+    // 양 끝: 항상 0 / 항상 최댓값
+    uint32_t acc = 0, bad = 0;
+    for (int p = 0; p < 1000; p++) if (rgb_dither_next(&acc, 0) != 0) bad++;
+    acc = 0;
+    for (int p = 0; p < 1000; p++) if (rgb_dither_next(&acc, FINE_MAX) != PWM_PERIOD) bad++;
+    CHECK_EQ(bad, 0);
+}
+
+// ■ 페이드: 주기마다 fine 이 바뀌어도 누적 오차 (출력 합 - fine 합) 가 1 카운트 미만
+static void test_fade(void) {
+    srand(11);
+    double worst = 0;
+    for (int run = 0; run < 200; run++) {
+        uint32_t acc = 0;
+        int64_t out_sum = 0, fine_sum = 0;      // 카운트 합 x 64, fine 합
+        uint32_t from = (uint32_t)rand() % (FINE_MAX + 1U), to = (uint32_t)rand() % (FINE_MAX + 1U);
+        uint32_t periods = 1000U + (uint32_t)rand() % 50000U;
+        for (uint32_t p = 0; p < periods; p++) {
+            uint32_t fine = (uint32_t)((int64_t)from + ((int64_t)to - from) * p / periods);
+            out_sum += (int64_t)RGB_FINE(rgb_dither_next(&acc, fine));
+            fine_sum += fine;
+            double e = fabs((double)(out_sum - fine_sum)) / (1U << RGB_DITHER_BITS);
+            if (e > worst) worst = e;
+        }
+    }
+    CHECK(worst < 1.0);
+    printf("  페이드 200 회: 누적 출력 - 누적 fine 최대 %.3f 카운트\n", worst);
+}
+
+static void test_integer(void) {
+    uint32_t bad = 0;
+    for (uint32_t counts = 0; counts <= PWM_PERIOD; counts++) {
+        uint32_t fine = RGB_FINE(counts);
+        for (uint32_t start = 0; start <= RGB_DITHER_MASK; start++) {
+            uint32_t acc = start;
+            for (int period = 0; period < 4; period++) {
+                if (rgb_dither_next(&acc, fine) != RGB_FINE_ROUND(fine)) bad++;
+            }
+            if (acc != start) bad++;
+        }
+    }
+    CHECK_EQ(bad, 0);
+}
+
+static void bench(void) {
+    uint32_t acc[3] = {0}, fine[3] = { 12345, 40000, 777 };
+    const uint32_t reps = 20000000;
+    uint64_t t0 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) {
+        for (int ch = 0; ch < 3; ch++) g_test_sink += rgb_dither_next(&acc[ch], fine[ch] + (r & 1U));
+    }
+    uint64_t t1 = now_ns();
+    printf("  세 채널 한 주기: %.2f ns (PC)\n", (double)(t1 - t0) / reps);
+}
+
+int main(void) {
+    test_static();
+    test_integer();
+    test_fade();
+    bench();
+    return TEST_END();
+}
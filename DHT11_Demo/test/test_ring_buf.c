@@ -0,0 +1,303 @@
+/***
+ ring_buf (범용 링버퍼 + 구간 통계) 호스트 테스트 + 벤치마크
+ - 무작위 / 단조 증가 / 단조 감소 / 같은 값 / 양 끝 값 입력을 여러 타입, 여러 크기로 넣고,
+   push 할 때마다 마지막 N개를 직접 다시 계산한 값 (브루트포스) 과 평균 / 분산 / 최솟값 / 최댓값 / 개수 비교
+ - seq (32비트) 넘어감, 0 도 버리지 않음 (기준 커밋의 ring_buf_t 는 0 을 건너뜀)
+ - RING_BUF_DEFINE_MEAN (평균만 유지): 평균 / 개수, name_scan() 의 최솟값 / 최댓값 / 분산도 같은 방식으로 비교
+ - 벤치마크 (PC, 원소 하나 push + 조회 시간)
+   기준 커밋 ring_buf_t (60개, %, 평균만) / RING_BUF_DEFINE_MEAN 64개 평균 / RING_BUF_DEFINE 64개 평균만 /
+   평균 + 분산 + 최솟값 + 최댓값 / 같은 통계를 매번 버퍼 전체에서 다시 계산 (브루트포스)
+ ***/
+#include "test_util.h"
+#include <stdlib.h>
+#include <string.h>
+#include "ring_buf.h"
+
+RING_BUF_DEFINE(rb_u8_1, uint8_t, 0)
+RING_BUF_DEFINE(rb_u8_16, uint8_t, 4)
+RING_BUF_DEFINE(rb_u16_8, uint16_t, 3)
+RING_BUF_DEFINE(rb_u16_64, uint16_t, 6)
+RING_BUF_DEFINE(rb_i16_32, int16_t, 5)
+RING_BUF_DEFINE(rb_i32_4, int32_t, 2)
+RING_BUF_DEFINE_MEAN(rm_u8_1, uint8_t, 0)
+RING_BUF_DEFINE_MEAN(rm_u16_8, uint16_t, 3)
+RING_BUF_DEFINE_MEAN(rm_u16_64, uint16_t, 6)
+RING_BUF_DEFINE_MEAN(rm_i16_32, int16_t, 5)
+
+#define HISTORY (1 << 16)
+static int64_t g_hist[HISTORY];     // 넣은 값 (브루트포스 기준)
+
+typedef struct {
+    int64_t mean;
+    uint32_t variance;
+    int64_t min;
+    int64_t max;
+    uint32_t count;
+} stats_t;
+
+// ■ 마지막 n 개 (최대 size) 를 직접 계산
+static stats_t brute(uint32_t pushed, uint32_t size) {
+    stats_t s = {0};
+    uint32_t n = (pushed < size) ? pushed : size;
+    s.count = n;
+    if (n == 0) return s;
+    int64_t sum = 0;
+    uint64_t sum_sq = 0;
+    s.min = INT64_MAX;
+    s.max = INT64_MIN;
+    for (uint32_t i = pushed - n; i < pushed; i++) {
+        int64_t v = g_hist[i % HISTORY];
+        sum += v;
+        sum_sq += (uint64_t)(v * v);
+        if (v < s.min) s.min = v;
+        if (v > s.max) s.max = v;
+    }
+    int64_t half = (sum >= 0) ? (int64_t)n / 2 : -(int64_t)(n / 2);
+    s.mean = (sum + half) / (int64_t)n;                 // 반올림 (0 에서 먼 쪽)
+    uint64_t sum_abs = (uint64_t)((sum >= 0) ? sum : -sum);
+    s.variance = (uint32_t)(((uint64_t)n * sum_sq - sum_abs * sum_abs) / ((uint64_t)n * n));
+    return s;
+}
+
+// 입력 패턴
+enum { PAT_RANDOM, PAT_UP, PAT_DOWN, PAT_CONST, PAT_EXTREME, PAT_SAWTOOTH, PAT_COUNT };
+
+static int64_t pattern(int pat, uint32_t i, int64_t lo, int64_t hi) {
+    int64_t span = hi - lo + 1;
+    switch (pat) {
+        case PAT_UP:       return lo + (int64_t)(i % (uint32_t)(span < 1000 ? span : 1000));
+        case PAT_DOWN:     return hi - (int64_t)(i % (uint32_t)(span < 1000 ? span : 1000));
+        case PAT_CONST:    return (i / 100U) % 2U ? lo : hi;
+        case PAT_EXTREME:  return (rand() & 1) ? lo : hi;
+        case PAT_SAWTOOTH: return lo + (int64_t)((i * 37U) % 13U) * (span / 13);
+        default:           return lo + (int64_t)(((uint64_t)rand() << 16 ^ (uint64_t)rand()) % (uint64_t)span);
+    }
+}
+
+// 타입마다 같은 검사 (push > 조회 > 브루트포스 비교), seq 는 32비트 넘어가기 직전부터
+#define CHECK_TYPE(name, type, lo, hi, pushes, with_variance)                                         \
+    do {                                                                                              \
+        static name##_t rb;                                                                           \
+        for (int pat = 0; pat < PAT_COUNT; pat++) {                                                   \
+            name##_init(&rb);                                                                         \
+            rb.seq = 0xFFFFFF00U - (uint32_t)pat;                                                     \
+            uint32_t bad = 0;                                                                         \
+            for (uint32_t i = 0; i < (pushes); i++) {                                                 \
+                int64_t v = pattern(pat, i, (lo), (hi));                                              \
+                g_hist[i % HISTORY] = v;                                                              \
+                name##_push(&rb, (type)v);                                                            \
+                stats_t ref = brute(i + 1U, name##_SIZE);                                             \
+                if ((int64_t)name##_mean(&rb) != ref.mean) bad++;                                     \
+                if ((int64_t)name##_min(&rb) != ref.min) bad++;                                       \
+                if ((int64_t)name##_max(&rb) != ref.max) bad++;                                       \
+                if (name##_count(&rb) != ref.count) bad++;                                            \
+                if ((with_variance) && name##_variance(&rb) != ref.variance) bad++;                   \
+            }                                                                                         \
+            if (bad != 0) printf("  %s 패턴 %d: 불일치 %u\n", #name, pat, (unsigned)bad);           \
+            CHECK_EQ(bad, 0);                                                                         \
+        }                                                                                             \
+    } while (0)
+
+// 평균만 유지하는 버퍼: 평균 / 개수는 push 마다, 최솟값 / 최댓값 / 분산은 name_scan() (가끔 조회하는 용도라 일부만)
+#define CHECK_TYPE_MEAN(name, type, lo, hi, pushes)                                                   \
+    do {                                                                                              \
+        static name##_t rb;                                                                           \
+        for (int pat = 0; pat < PAT_COUNT; pat++) {                                                   \
+            name##_init(&rb);                                                                         \
+            rb.seq = 0xFFFFFF00U - (uint32_t)pat;                                                     \
+            uint32_t bad = 0;                                                                         \
+            for (uint32_t i = 0; i < (pushes); i++) {                                                 \
+                int64_t v = pattern(pat, i, (lo), (hi));                                              \
+                g_hist[i % HISTORY] = v;                                                              \
+                name##_push(&rb, (type)v);                                                            \
+                stats_t ref = brute(i + 1U, name##_SIZE);                                             \
+                if ((int64_t)name##_mean(&rb) != ref.mean) bad++;                                     \
+                if (name##_count(&rb) != ref.count) bad++;                                            \
+                if (i % 7U == 0 || i < name##_SIZE) {                                                 \
+                    type mn, mx;                                                                      \
+                    uint32_t variance;                                                                \
+                    name##_scan(&rb, &mn, &mx, &variance);                                            \
+                    if ((int64_t)mn != ref.min || (int64_t)mx != ref.max) bad++;                      \
+                    if (variance != ref.variance) bad++;                                              \
+                }                                                                                     \
+            }                                                                                         \
+            if (bad != 0) printf("  %s 패턴 %d: 불일치 %u\n", #name, pat, (unsigned)bad);           \
+            CHECK_EQ(bad, 0);                                                                         \
+        }                                                                                             \
+    } while (0)
+
+static void test_brute_force(void) {
+    srand(7);
+    CHECK_TYPE(rb_u8_1, uint8_t, 0, 255, 2000, 1);
+    CHECK_TYPE(rb_u8_16, uint8_t, 0, 255, 20000, 1);
+    CHECK_TYPE(rb_u16_8, uint16_t, 0, 4095, 20000, 1);
+    CHECK_TYPE(rb_u16_64, uint16_t, 0, 65535, 20000, 1);
+    CHECK_TYPE(rb_i16_32, int16_t, -32768, 32767, 20000, 1);
+    CHECK_TYPE(rb_i32_4, int32_t, -1000000000, 1000000000, 20000, 0); // 분산은 16비트 이하 원소만
+    CHECK_TYPE_MEAN(rm_u8_1, uint8_t, 0, 255, 2000);
+    CHECK_TYPE_MEAN(rm_u16_8, uint16_t, 0, 4095, 20000);
+    CHECK_TYPE_MEAN(rm_u16_64, uint16_t, 0, 65535, 20000);
+    CHECK_TYPE_MEAN(rm_i16_32, int16_t, -32768, 32767, 20000);
+}
+
+static void test_edge(void) {
+    static rb_u16_8_t rb;
+    rb_u16_8_init(&rb);
+    // 비어 있을 때
+    CHECK_EQ(rb_u16_8_mean(&rb), 0);
+    CHECK_EQ(rb_u16_8_variance(&rb), 0);
+    CHECK_EQ(rb_u16_8_min(&rb), 0);
+    CHECK_EQ(rb_u16_8_max(&rb), 0);
+    CHECK_EQ(rb_u16_8_count(&rb), 0);
+    // 0 도 평균에 들어감 (완전히 어두운 값)
+    rb_u16_8_push(&rb, 4000);
+    rb_u16_8_push(&rb, 0);
+    CHECK_EQ(rb_u16_8_count(&rb), 2);
+    CHECK_EQ(rb_u16_8_mean(&rb), 2000);
+    CHECK_EQ(rb_u16_8_min(&rb), 0);
+    // 반올림: (1 + 2) / 2 = 1.5 > 2, 음수는 0 에서 먼 쪽
+    rb_u16_8_init(&rb);
+    rb_u16_8_push(&rb, 1);
+    rb_u16_8_push(&rb, 2);
+    CHECK_EQ(rb_u16_8_mean(&rb), 2);
+    static rb_i16_32_t rs;
+    rb_i16_32_init(&rs);
+    rb_i16_32_push(&rs, -1);
+    rb_i16_32_push(&rs, -2);
+    CHECK_EQ(rb_i16_32_mean(&rs), -2);
+    // 최대 분산 (0 과 65535 반반)
+    static rb_u16_64_t rm;
+    rb_u16_64_init(&rm);
+    for (int i = 0; i < 64; i++) rb_u16_64_push(&rm, (uint16_t)((i & 1) ? 65535 : 0));
+    CHECK_EQ(rb_u16_64_variance(&rm), 1073709056U); // 65535^2 / 4 (내림)
+
+    // 평균만 유지하는 버퍼: 비어 있을 때 / 0 포함 / 최대 분산
+    static rm_u16_64_t rq;
+    uint16_t mn = 1, mx = 1;
+    uint32_t variance = 1;
+    rm_u16_64_init(&rq);
+    rm_u16_64_scan(&rq, &mn, &mx, &variance);
+    CHECK_EQ(rm_u16_64_mean(&rq), 0);
+    CHECK(mn == 0 && mx == 0 && variance == 0);
+    rm_u16_64_push(&rq, 4000);
+    rm_u16_64_push(&rq, 0);
+    rm_u16_64_scan(&rq, &mn, &mx, &variance);
+    CHECK_EQ(rm_u16_64_mean(&rq), 2000);
+    CHECK(mn == 0 && mx == 4000 && variance == 4000000U);
+    for (int i = 0; i < 64; i++) rm_u16_64_push(&rq, (uint16_t)((i & 1) ? 65535 : 0));
+    rm_u16_64_scan(&rq, &mn, &mx, &variance);
+    CHECK_EQ(variance, 1073709056U);
+}
+
+/*** 기준 커밋 ring_buf_t (hal_entry.c 에서 그대로 옮김) ***/
+#define ADC_BUFFER_SIZE 60
+typedef struct {
+    uint16_t buffer[ADC_BUFFER_SIZE];
+    int head;
+    int tail;
+    int count;
+    uint32_t sum;
+} ring_buf_t;
+
+static void ring_buf_init(ring_buf_t *rb) {
+    memset(rb->buffer, 0, sizeof(rb->buffer));
+    rb->head = 0;
+    rb->tail = 0;
+    rb->count = 0;
+    rb->sum = 0;
+}
+
+static void ring_buf_push(ring_buf_t *rb, uint16_t data) {
+    if (data != 0) {
+        if (rb->count == ADC_BUFFER_SIZE) {
+            rb->sum -= rb->buffer[rb->head];
+            rb->head = (rb->head + 1) % ADC_BUFFER_SIZE;
+        }
+        rb->buffer[rb->tail] = data;
+        rb->sum += data;
+        rb->tail = (rb->tail + 1) % ADC_BUFFER_SIZE;
+        if (rb->count < ADC_BUFFER_SIZE) rb->count++;
+    }
+}
+
+static uint16_t ring_buf_avg(ring_buf_t *rb) {
+    return (uint16_t)(rb->count > 0 ? rb->sum / (uint32_t)rb->count : 0);
+}
+
+static void bench(void) {
+    enum { N = 1 << 14 };
+    static uint16_t input[N];
+    srand(3);
+    for (int i = 0; i < N; i++) input[i] = (uint16_t)(1 + rand() % 4095);
+    const uint32_t reps = 600;
+    static ring_buf_t old;
+    static rb_u16_64_t rb;
+    static rm_u16_64_t rq;
+
+    rm_u16_64_init(&rq);
+    uint64_t tm0 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) {
+        for (int i = 0; i < N; i++) {
+            rm_u16_64_push(&rq, input[i]);
+            g_test_sink += rm_u16_64_mean(&rq);
+        }
+    }
+    uint64_t tm1 = now_ns();
+    ring_buf_init(&old);
+    uint64_t t0 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) {
+        for (int i = 0; i < N; i++) {
+            ring_buf_push(&old, input[i]);
+            g_test_sink += ring_buf_avg(&old);
+        }
+    }
+    uint64_t t1 = now_ns();
+    rb_u16_64_init(&rb);
+    for (uint32_t r = 0; r < reps; r++) {
+        for (int i = 0; i < N; i++) {
+            rb_u16_64_push(&rb, input[i]);
+            g_test_sink += rb_u16_64_mean(&rb);
+        }
+    }
+    uint64_t t2 = now_ns();
+    rb_u16_64_init(&rb);
+    for (uint32_t r = 0; r < reps; r++) {
+        for (int i = 0; i < N; i++) {
+            rb_u16_64_push(&rb, input[i]);
+            g_test_sink += rb_u16_64_mean(&rb) + rb_u16_64_variance(&rb) + rb_u16_64_min(&rb) + rb_u16_64_max(&rb);
+        }
+    }
+    uint64_t t3 = now_ns();
+    // 기준 커밋 버퍼 + 분산 / 최솟값 / 최댓값을 조회할 때마다 전체에서 다시 계산
+    ring_buf_init(&old);
+    for (uint32_t r = 0; r < reps / 10; r++) {
+        for (int i = 0; i < N; i++) {
+            ring_buf_push(&old, input[i]);
+            uint64_t sum_sq = 0;
+            uint16_t mn = 0xFFFF, mx = 0;
+            for (int k = 0; k < old.count; k++) {
+                uint16_t v = old.buffer[k];
+                sum_sq += (uint64_t)v * v;
+                if (v < mn) mn = v;
+                if (v > mx) mx = v;
+            }
+            uint64_t n = (uint64_t)old.count;
+            g_test_sink += ring_buf_avg(&old) + (uint32_t)((n * sum_sq - (uint64_t)old.sum * old.sum) / (n * n)) + mn + mx;
+        }
+    }
+    uint64_t t4 = now_ns();
+
+    double per = (double)reps * N;
+    printf("  push + 평균: 기준 ring_buf_t (60, %%) %.2f ns, RING_BUF_DEFINE_MEAN (64, &) %.2f ns, "
+           "RING_BUF_DEFINE (64, &, 통계 전부 갱신) %.2f ns\n",
+           (double)(t1 - t0) / per, (double)(tm1 - tm0) / per, (double)(t2 - t1) / per);
+    printf("  push + 평균/분산/최솟값/최댓값: O(1) %.2f ns, 매번 전체 다시 계산 (60개) %.2f ns\n",
+           (double)(t3 - t2) / per, (double)(t4 - t3) / (per / 10));
+}
+
+int main(void) {
+    test_brute_force();
+    test_edge();
+    bench();
+    return TEST_END();
+}
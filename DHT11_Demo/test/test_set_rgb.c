@@ -0,0 +1,178 @@
+/***
+ rgb_sync_write() (set_rgb 의 레지스터 순서) 호스트 모델 검사
+ - 모델: 세 타이머 공통 카운터 (0 ~ 주기-1), 레지스터 접근 한 번마다 카운터가 무작위로 몇 카운트 진행
+   주기 끝마다 채널별로 GTUDDTYC.OADTY (0%/100%) 반영, GTBER.BD0 가 0 이면 GTCCRC > GTCCRA 전송
+   출력 듀티 = OADTY 0% > 0, 100% > 주기, 아니면 GTCCRA + 1
+ - 무작위 새 듀티 (0, 주기, 중간값, 그대로 섞어서) 를 무작위 위치에서 쓰고, 주기 끝에서 반영된 세 채널 값이
+   항상 "이전 값 세 개" 또는 "새 값 세 개" 인지 (섞인 색 없음), 쓰기 후 두 주기 안에 새 값이 되는지
+   주기 끝 직전 (40 카운트 안) 에서 시작하는 경우를 따로 많이 넣음
+ - 인터럽트 금지 구간 길이 (최대, 주기 단위)
+ - 반례 (모델이 섞인 색을 잡아내는지): 전송 금지 없이 세 채널 쓰기 / 전송 금지만 하고 주기 앞부분을 기다리지 않음
+ ***/
+#include "test_util.h"
+#include <stdlib.h>
+#include <string.h>
+#include "rgb_sync.h"
+
+#define PERIOD 1000
+#define WRITE_LIMIT (PERIOD / 2)
+#define GUARD 50
+#define TRIALS 200000
+
+static R_GPT0_Type g_gpt[3];
+static rgb_sync_t g_sync;
+
+static uint32_t g_cnt;              // 카운터 (세 타이머 공통)
+static uint64_t g_time;             // 지난 카운트 수
+static uint32_t g_oadty[3];         // 지금 주기에 적용 중인 OADTY
+static uint32_t g_cost_min = 1, g_cost_max = 4; // 레지스터 접근 한 번 (카운트)
+
+static _Bool g_checking;
+static uint32_t g_old[3], g_new[3]; // 주기 끝에서 허용되는 값 두 가지
+static uint32_t g_out[3];           // 마지막 주기 끝에서 반영된 출력 듀티
+static uint32_t g_cycle_ends;
+static uint32_t g_mixed;
+
+static uint32_t output_duty(uint8_t ch) {
+    if (g_oadty[ch] == RGB_SYNC_OADTY_0_PERCENT) return 0;
+    if (g_oadty[ch] == RGB_SYNC_OADTY_100_PERCENT) return PERIOD;
+    return g_gpt[ch].GTCCR[0] + 1U;
+}
+
+// ■ 주기 끝: OADTY 는 항상, GTCCRA 는 BD0 가 0 일 때만 반영
+static void cycle_end(void) {
+    for (uint8_t ch = 0; ch < 3; ch++) {
+        g_oadty[ch] = (g_gpt[ch].GTUDDTYC & R_GPT0_GTUDDTYC_OADTY_Msk) >> R_GPT0_GTUDDTYC_OADTY_Pos;
+        if ((g_gpt[ch].GTBER & R_GPT0_GTBER_BD0_Msk) == 0) g_gpt[ch].GTCCR[0] = g_gpt[ch].GTCCR[2];
+        g_out[ch] = output_duty(ch);
+    }
+    g_cycle_ends++;
+    if (g_checking && memcmp(g_out, g_old, sizeof(g_out)) != 0 && memcmp(g_out, g_new, sizeof(g_out)) != 0) {
+        g_mixed++;
+    }
+}
+
+static void advance(uint32_t counts) {
+    for (uint32_t i = 0; i < counts; i++) {
+        g_time++;
+        if (++g_cnt >= PERIOD) {
+            g_cnt = 0;
+            cycle_end();
+        }
+    }
+}
+
+static uint32_t access_cost(void) {
+    return g_cost_min + (uint32_t)rand() % (g_cost_max - g_cost_min + 1U);
+}
+
+uint32_t rgb_sync_host_read(volatile uint32_t *reg) {
+    advance(access_cost());
+    if (reg == &g_gpt[0].GTCNT) return g_cnt;
+    return *reg;
+}
+
+void rgb_sync_host_write(volatile uint32_t *reg, uint32_t value) {
+    advance(access_cost());
+    *reg = value;
+}
+
+static uint32_t random_duty(uint8_t ch) {
+    switch (rand() % 4) {
+        case 0:  return 0;
+        case 1:  return PERIOD;
+        case 2:  return g_out[ch];  // 그대로
+        default: return 1U + (uint32_t)rand() % (PERIOD - 1U);
+    }
+}
+
+// ■ 다음 쓰기 시작 위치: 무작위, 또는 주기 끝 직전
+static void move_to_start(_Bool near_end) {
+    uint32_t target = near_end ? PERIOD - 1U - (uint32_t)rand() % 40U : (uint32_t)rand() % PERIOD;
+    advance((target + PERIOD - g_cnt) % PERIOD);
+}
+
+static void reset_model(void) {
+    memset(g_gpt, 0, sizeof(g_gpt));
+    memset(g_oadty, 0, sizeof(g_oadty));
+    g_cnt = 0;
+    g_checking = false;
+    rgb_sync_init(&g_sync, &g_gpt[0], &g_gpt[1], &g_gpt[2], PERIOD, WRITE_LIMIT, GUARD);
+    const uint32_t start[3] = { PERIOD, PERIOD, PERIOD }; // 전원 켤 때 (hal_entry.c 와 같이 모두 100%)
+    rgb_sync_write(&g_sync, start);
+    advance(2 * PERIOD);
+}
+
+// ■ 무작위 쓰기 TRIALS 번, 섞인 색 / 늦은 반영 / 인터럽트 금지 구간 길이
+static void test_sync(uint32_t cost_min, uint32_t cost_max) {
+    g_cost_min = cost_min;
+    g_cost_max = cost_max;
+    reset_model();
+    g_mixed = 0;
+    uint32_t late = 0, crossed = 0, near_end_count = 0;
+    uint64_t longest = 0;
+    for (uint32_t t = 0; t < TRIALS; t++) {
+        _Bool near_end = (rand() % 3 == 0);
+        near_end_count += near_end;
+        move_to_start(near_end);
+        uint32_t duty[3];
+        for (uint8_t ch = 0; ch < 3; ch++) duty[ch] = random_duty(ch);
+        memcpy(g_old, g_out, sizeof(g_old));
+        memcpy(g_new, duty, sizeof(g_new));
+        g_checking = true;
+
+        uint32_t ends = g_cycle_ends;
+        uint64_t t0 = g_time;
+        rgb_sync_write(&g_sync, duty);
+        if (g_time - t0 > longest) longest = g_time - t0;
+        if (g_cycle_ends != ends) crossed++;  // 쓰는 도중에 주기 끝이 지나감 (BD0 로 막아야 하는 경우)
+        advance(2 * PERIOD);
+        if (memcmp(g_out, duty, sizeof(g_out)) != 0) late++;
+        g_checking = false;
+    }
+    printf("  접근당 %u~%u 카운트: %u 번 (주기 끝 직전 시작 %u, 도중에 주기 끝 %u) 섞인 색 %u, 반영 안 됨 %u, "
+           "인터럽트 금지 최대 %.2f 주기\n", (unsigned)cost_min, (unsigned)cost_max, TRIALS, (unsigned)near_end_count,
+           (unsigned)crossed, (unsigned)g_mixed, (unsigned)late, (double)longest / PERIOD);
+    CHECK(crossed > 0);
+    CHECK_EQ(g_mixed, 0);
+    CHECK_EQ(late, 0);
+    CHECK(longest <= PERIOD * 3U / 2U);
+}
+
+// ■ 반례: hold = 전송 금지 사용, window = 주기 앞부분까지 기다림
+static uint32_t counter_example(_Bool hold, _Bool window) {
+    g_cost_min = 1;
+    g_cost_max = 4;
+    reset_model();
+    g_mixed = 0;
+    for (uint32_t t = 0; t < TRIALS / 10; t++) {
+        move_to_start(true);
+        uint32_t duty[3];
+        for (uint8_t ch = 0; ch < 3; ch++) duty[ch] = random_duty(ch);
+        memcpy(g_old, g_out, sizeof(g_old));
+        memcpy(g_new, duty, sizeof(g_new));
+        g_checking = true;
+        if (hold) for (uint8_t ch = 0; ch < 3; ch++) rgb_sync_host_write(&g_gpt[ch].GTBER, R_GPT0_GTBER_BD0_Msk);
+        if (window) while (rgb_sync_host_read(&g_gpt[0].GTCNT) > WRITE_LIMIT) { }
+        for (uint8_t ch = 0; ch < 3; ch++) rgb_sync_compare(&g_sync, ch, duty[ch]);
+        if (hold) for (uint8_t ch = 0; ch < 3; ch++) rgb_sync_host_write(&g_gpt[ch].GTBER, 0);
+        advance(2 * PERIOD);
+        g_checking = false;
+    }
+    return g_mixed;
+}
+
+int main(void) {
+    srand(11);
+    test_sync(1, 4);
+    test_sync(4, 16);
+
+    uint32_t no_hold = counter_example(false, false);
+    uint32_t no_window = counter_example(true, false);
+    printf("  반례 (주기 끝 직전에서 %u 번): 전송 금지 없이 쓰기 > 섞인 색 %u 번, 전송 금지만 (0%%/100%% 는 주기 끝에 바로 반영) > %u 번\n",
+           TRIALS / 10, (unsigned)no_hold, (unsigned)no_window);
+    CHECK(no_hold > 0);
+    CHECK(no_window > 0);
+    CHECK_EQ(counter_example(true, true), 0);
+    return TEST_END();
+}
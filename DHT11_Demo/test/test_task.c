@@ -0,0 +1,282 @@
+/***
+ task (스택 없는 협력형 태스크) 호스트 테스트 + 벤치마크, 가상 시간 (tw_tick 한 번 = 1틱)
+ - TASK_SLEEP: 7틱 잠들기를 반복하면 7000틱 동안 정확히 1000번, 깨어나는 틱이 7의 배수
+   여러 태스크가 서로 다른 주기로 동시에 잠들어도 각자 정확
+ - TASK_AWAIT_TIMEOUT: 이벤트가 먼저 오면 이벤트로 (타임아웃 취소), 아니면 timeout 틱 뒤 timed_out
+ - 이벤트는 디스패치 순간에 기다리던 태스크에게만 (기다리지 않는 태스크는 건너뜀)
+ - TASK_WAIT_UNTIL: 조건이 참이 될 때까지, timeout 마다 다시 확인 (이벤트가 와도 주기 유지) / TASK_YIELD: 다음 디스패치에서 이어서
+ - TASK_END: 처음으로 돌아가지만, 기다리는 것이 없으므로 다시 불리지 않음
+ - task_ticks_until: 마감 시각 기준 대기 (지났으면 1)
+ - 벤치마크 (PC): 양보 후 재개, 이벤트로 재개, 기다리지 않는 태스크 건너뛰기 (한 번당 ns)
+ ***/
+#include "test_util.h"
+#include <stdbool.h>
+#include <string.h>
+#include "task.h"
+
+#define EV_WAKE (1UL << 0)
+#define EV_A    (1UL << 1)
+#define EV_B    (1UL << 2)
+
+static timer_wheel_t g_wheel;
+static uint32_t g_pending;
+static uint32_t g_ticks;            // 지금까지 tw_tick 횟수
+
+static void post(uint32_t events) {
+    g_pending |= events;
+}
+
+// ■ 메인 루프 한 바퀴: 올라온 이벤트를 모두 디스패치 (태스크가 다시 올리면 이어서)
+static void dispatch_all(task_t *const tasks[], uint8_t count) {
+    while (g_pending != 0) {
+        uint32_t events = g_pending;
+        g_pending = 0;
+        task_dispatch(tasks, count, events);
+    }
+}
+
+static void tick(task_t *const tasks[], uint8_t count) {
+    tw_tick(&g_wheel);
+    g_ticks++;
+    dispatch_all(tasks, count);
+}
+
+static void setup(uint32_t start) {
+    tw_init(&g_wheel, start);
+    g_pending = 0;
+    g_ticks = 0;
+    task_sched_init(&g_wheel, post, EV_WAKE);
+}
+
+/*** 잠들기 ***/
+typedef struct {
+    task_t task;
+    uint32_t period;
+    uint32_t wakes;
+    uint32_t bad;           // 주기의 배수가 아닌 틱에 깨어남
+} sleeper_t;
+
+static uint8_t sleeper(task_t *t) {
+    sleeper_t *s = (sleeper_t *)t;
+    TASK_BEGIN(t);
+    while (1) {
+        TASK_SLEEP(t, s->period);
+        s->wakes++;
+        if (g_ticks != s->wakes * s->period) s->bad++;
+    }
+    TASK_END(t);
+}
+
+static void test_sleep(void) {
+    static sleeper_t s[4];
+    static const uint32_t periods[] = { 7, 1, 64, 1000 };
+    task_t *tasks[4];
+    setup(0xFFFFF000U);     // 도중에 틱 카운터가 넘어감
+    for (int i = 0; i < 4; i++) {
+        memset(&s[i], 0, sizeof(s[i]));
+        s[i].period = periods[i];
+        task_init(&s[i].task, sleeper);
+        tasks[i] = &s[i].task;
+    }
+    dispatch_all(tasks, 4);
+    for (int k = 0; k < 7000; k++) tick(tasks, 4);
+    for (int i = 0; i < 4; i++) {
+        CHECK_EQ(s[i].wakes, 7000U / periods[i]);
+        CHECK_EQ(s[i].bad, 0);
+    }
+    printf("  7틱 잠들기: 7000틱 동안 %u 번 (1, 64, 1000틱: %u, %u, %u 번), 어긋난 틱 0\n",
+           (unsigned)s[0].wakes, (unsigned)s[1].wakes, (unsigned)s[2].wakes, (unsigned)s[3].wakes);
+}
+
+/*** 이벤트 / 타임아웃 / 조건 / 양보 ***/
+typedef struct {
+    task_t task;
+    uint32_t step;
+    uint32_t woke_at;
+    _Bool timed_out;
+    uint32_t events;
+} waiter_t;
+
+static volatile _Bool g_cond;
+
+static uint8_t waiter(task_t *t) {
+    waiter_t *w = (waiter_t *)t;
+    TASK_BEGIN(t);
+    w->step = 1;
+    TASK_AWAIT_TIMEOUT(t, EV_A, 50);            // 1: 이벤트가 먼저
+    w->woke_at = g_ticks; w->timed_out = t->timed_out; w->events = t->events;
+    w->step = 2;
+    TASK_AWAIT_TIMEOUT(t, EV_A, 50);            // 2: 타임아웃
+    w->woke_at = g_ticks; w->timed_out = t->timed_out; w->events = t->events;
+    w->step = 3;
+    TASK_WAIT_UNTIL(t, g_cond, EV_B, 100);      // 3: EV_B 마다 / 100틱마다 조건 확인
+    w->woke_at = g_ticks; w->timed_out = t->timed_out;
+    w->step = 4;
+    TASK_YIELD(t);                              // 4: 다음 디스패치에서 이어서
+    w->step = 5;
+    TASK_AWAIT(t, EV_B);
+    w->step = 6;
+    TASK_END(t);
+}
+
+static void test_wait(void) {
+    static waiter_t w, idle;
+    task_t *tasks[2] = { &w.task, &idle.task };
+    setup(0);
+    memset(&w, 0, sizeof(w));
+    memset(&idle, 0, sizeof(idle));
+    task_init(&w.task, waiter);
+    task_init(&idle.task, waiter);
+    dispatch_all(tasks, 1);                     // idle 은 시작하지 않음 (ready 그대로)
+    CHECK_EQ(w.step, 1);
+
+    for (int k = 0; k < 10; k++) tick(tasks, 1);
+    post(EV_A);
+    dispatch_all(tasks, 1);
+    CHECK_EQ(w.step, 2);
+    CHECK_EQ(w.woke_at, 10);
+    CHECK(!w.timed_out);
+    CHECK_EQ(w.events, EV_A);
+
+    for (int k = 0; k < 49; k++) tick(tasks, 1);
+    CHECK_EQ(w.step, 2);                        // 49틱: 아직
+    tick(tasks, 1);
+    CHECK_EQ(w.step, 3);                        // 50틱째 타임아웃
+    CHECK_EQ(w.woke_at, 60);
+    CHECK(w.timed_out);
+    CHECK_EQ(w.events, 0);
+
+    for (int k = 0; k < 30; k++) {
+        if (k % 10 == 0) post(EV_B);            // 조건은 아직 거짓 > 계속 대기
+        tick(tasks, 1);
+    }
+    CHECK_EQ(w.step, 3);
+    g_cond = true;
+    post(EV_B);
+    uint32_t events = g_pending | EV_A;         // 기다리지 않는 이벤트는 무시
+    g_pending = 0;
+    task_dispatch(tasks, 1, events);
+    CHECK_EQ(w.step, 4);                        // 조건 참 > 양보
+    CHECK_EQ(w.woke_at, 90);
+    CHECK(!w.timed_out);
+    CHECK(g_pending & EV_WAKE);                 // 양보는 깨우기 이벤트를 올림
+    dispatch_all(tasks, 1);
+    CHECK_EQ(w.step, 5);
+    post(EV_A);                                 // 기다리지 않는 이벤트
+    dispatch_all(tasks, 1);
+    CHECK_EQ(w.step, 5);
+    post(EV_B);
+    dispatch_all(tasks, 1);
+    CHECK_EQ(w.step, 6);
+    CHECK_EQ(w.task.lc, 0);                     // TASK_END > 다시 불리면 처음부터
+    post(EV_A | EV_B);
+    dispatch_all(tasks, 1);
+    CHECK_EQ(w.step, 6);                        // 기다리는 것이 없으면 다시 불리지 않음
+
+    // TASK_WAIT_UNTIL: timeout 은 조건 다시 확인 주기 (이벤트가 와도 처음 주기 유지)
+    g_cond = false;
+    setup(0);
+    task_init(&w.task, waiter);
+    dispatch_all(tasks, 1);
+    post(EV_A);
+    dispatch_all(tasks, 1);
+    for (int k = 0; k < 50; k++) tick(tasks, 1);
+    CHECK_EQ(w.step, 3);                        // 50틱부터 조건 대기, 확인은 150, 250, 350 틱
+    for (int k = 0; k < 210; k++) {
+        post(EV_B);                             // 조건 거짓 > 계속 대기
+        tick(tasks, 1);
+    }
+    CHECK_EQ(w.step, 3);
+    g_cond = true;                              // 이벤트 없이 참 > 다음 주기 확인 (350틱) 에서
+    for (int k = 0; k < 89; k++) tick(tasks, 1);
+    CHECK_EQ(w.step, 3);
+    tick(tasks, 1);
+    CHECK_EQ(w.step, 5);                        // 양보 후 같은 메인 루프 안에서 이어서
+    CHECK_EQ(w.woke_at, 350);
+    CHECK(w.timed_out);
+}
+
+static void test_ticks_until(void) {
+    setup(1000);
+    CHECK_EQ(task_now(), 1000);
+    CHECK_EQ(task_ticks_until(1500), 500);
+    CHECK_EQ(task_ticks_until(1000), 1);        // 지금 > 다음 틱
+    CHECK_EQ(task_ticks_until(900), 1);         // 지남 > 다음 틱
+    setup(0xFFFFFFF0U);
+    CHECK_EQ(task_ticks_until(0x10U), 0x20);    // 넘어감
+}
+
+/*** 벤치마크 ***/
+typedef struct {
+    task_t task;
+    uint32_t count;
+} counter_t;
+
+static uint8_t yielder(task_t *t) {
+    counter_t *c = (counter_t *)t;
+    TASK_BEGIN(t);
+    while (1) {
+        c->count++;
+        TASK_YIELD(t);
+    }
+    TASK_END(t);
+}
+
+static uint8_t event_waiter(task_t *t) {
+    counter_t *c = (counter_t *)t;
+    TASK_BEGIN(t);
+    while (1) {
+        TASK_AWAIT(t, EV_A);
+        c->count++;
+    }
+    TASK_END(t);
+}
+
+static void bench(void) {
+    static counter_t y, e, others[8];
+    task_t *tasks[9];
+    const uint32_t reps = 20000000;
+    setup(0);
+
+    task_init(&y.task, yielder);
+    tasks[0] = &y.task;
+    y.count = 0;
+    uint64_t t0 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) task_dispatch(tasks, 1, EV_WAKE);
+    uint64_t t1 = now_ns();
+    CHECK_EQ(y.count, reps);
+    g_pending = 0;
+
+    task_init(&e.task, event_waiter);
+    tasks[0] = &e.task;
+    task_dispatch(tasks, 1, EV_WAKE);
+    uint64_t t2 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) task_dispatch(tasks, 1, EV_A);
+    uint64_t t3 = now_ns();
+    CHECK_EQ(e.count, reps);
+
+    // 이벤트를 기다리는 태스크 1개 + 다른 이벤트를 기다리는 태스크 8개 (건너뜀)
+    for (int i = 0; i < 8; i++) {
+        task_init(&others[i].task, event_waiter);
+        tasks[1 + i] = &others[i].task;
+    }
+    task_dispatch(tasks, 9, EV_WAKE);
+    e.count = 0;
+    uint64_t t4 = now_ns();
+    for (uint32_t r = 0; r < reps; r++) task_dispatch(tasks, 9, EV_WAKE);
+    uint64_t t5 = now_ns();
+    CHECK_EQ(e.count, 0);
+    g_test_sink += y.count + e.count;
+
+    printf("  양보 후 재개 %.1f ns, 이벤트로 재개 %.1f ns, 기다리지 않는 태스크 건너뛰기 %.1f ns (PC), task_t %u 바이트\n",
+           (double)(t1 - t0) / reps, (double)(t3 - t2) / reps, (double)(t5 - t4) / reps / 9.0,
+           (unsigned)sizeof(task_t));
+}
+
+int main(void) {
+    test_sleep();
+    test_wait();
+    test_ticks_until();
+    bench();
+    return TEST_END();
+}
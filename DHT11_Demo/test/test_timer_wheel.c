@@ -0,0 +1,194 @@
+/***
+ timer_wheel (계층형 타이머 휠) 호스트 테스트 + 벤치마크, 가상 시간
+ - 무작위: 타이머 64개를 무작위로 시작 / 다시 시작 / 취소 (one-shot, 주기, delay 0 ~ TW_MAX_DELTA 너머),
+   콜백 안에서 자기 자신 다시 시작 / 다른 타이머 취소, 그동안 틱 카운터가 32비트를 넘어감
+   기준 모델: tw_start(delay) 를 tw_tick k 번 뒤에 부르면 k + max(delay, 1) 번째 tw_tick 에서 만료, 주기는 그 뒤 period 마다
+ - 확인: 모든 콜백이 정확히 그 tw_tick 에서 (빠르지도 늦지도 않게), 빠짐 / 중복 / 취소된 타이머 콜백 없음,
+         tw_remaining() = 만료까지 남은 tw_tick 횟수, tw_pending() 은 모델과 같음
+ - 벤치마크: 대기 중인 타이머 수에 따른 tw_tick 한 번 / tw_start 한 번 (PC)
+ ***/
+#include "test_util.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include "timer_wheel.h"
+
+#define TW_MAX_DELTA_TICKS ((1UL << (TW_LEVEL_BITS * TW_LEVELS)) - 1U)
+#define TIMERS 64
+
+typedef struct {
+    tw_timer_t timer;
+    _Bool pending;          // 모델: 대기 중
+    uint64_t due;           // 모델: 만료될 tw_tick 번호 (1부터)
+    uint32_t period;
+    uint32_t fired;
+} model_t;
+
+static timer_wheel_t g_wheel;
+static model_t g_m[TIMERS];
+static uint64_t g_calls;    // 지금까지 (진행 중 포함) tw_tick 횟수
+static uint32_t g_early, g_late, g_stray, g_fires;
+static uint32_t g_max_delay = 5000;
+
+static uint32_t rnd32(void) {
+    return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+static uint32_t random_delay(void) {
+    uint32_t r = (uint32_t)rand() % 100U;
+    if (r < 5) return 0;
+    if (r < 70) return 1U + rnd32() % 70U;                 // 레벨 0 ~ 1
+    if (r < 97) return 1U + rnd32() % g_max_delay;         // 레벨 2 ~
+    return TW_MAX_DELTA_TICKS - 50U + rnd32() % 100U;      // 가장 먼 슬롯 경계 (너머 포함)
+}
+
+static void model_start(model_t *m, uint32_t delay, uint32_t period) {
+    tw_start(&g_wheel, &m->timer, delay, period);
+    m->pending = true;
+    m->due = g_calls + (delay ? delay : 1U);
+    m->period = period;
+}
+
+static void model_cancel(model_t *m) {
+    tw_cancel(&m->timer);
+    m->pending = false;
+}
+
+static void callback(tw_timer_t *timer, void *arg) {
+    (void)timer;
+    model_t *m = (model_t *)arg;
+    g_fires++;
+    m->fired++;
+    if (!m->pending) { g_stray++; return; }
+    if (g_calls < m->due) g_early++;
+    if (g_calls > m->due) g_late++;
+    if (m->period != 0) m->due += m->period;
+    else m->pending = false;
+
+    // 콜백 안에서: 가끔 자기 자신 다시 시작 / 다른 타이머 취소
+    int r = rand() % 16;
+    if (r == 0) model_start(m, random_delay(), 0);
+    else if (r == 1) model_cancel(&g_m[rand() % TIMERS]);
+    else if (r == 2 && m->period != 0) model_cancel(m);
+}
+
+static void check_model(uint32_t *bad_pending, uint32_t *bad_remaining) {
+    for (int i = 0; i < TIMERS; i++) {
+        model_t *m = &g_m[i];
+        if (tw_pending(&m->timer) != m->pending) (*bad_pending)++;
+        uint32_t expect = m->pending ? (uint32_t)(m->due - g_calls) : 0U;
+        if (tw_remaining(&g_wheel, &m->timer) != expect) (*bad_remaining)++;
+    }
+}
+
+// ■ 무작위 시작 / 취소 + 틱 (start: 시작 틱, 도중에 32비트 넘어감)
+static void test_random(uint32_t start, uint64_t ticks, uint32_t max_delay) {
+    tw_init(&g_wheel, start);
+    g_max_delay = max_delay;
+    g_calls = 0;
+    g_early = g_late = g_stray = g_fires = 0;
+    for (int i = 0; i < TIMERS; i++) {
+        tw_timer_init(&g_m[i].timer, callback, &g_m[i]);
+        g_m[i].pending = false;
+        g_m[i].fired = 0;
+    }
+    uint32_t bad_pending = 0, bad_remaining = 0, missed = 0;
+    for (uint64_t k = 0; k < ticks; k++) {
+        if ((rand() & 7) == 0) {
+            model_t *m = &g_m[rand() % TIMERS];
+            int r = rand() % 8;
+            if (r < 5) model_start(m, random_delay(), 0);
+            else if (r < 7) model_start(m, random_delay(), 1U + (uint32_t)rand() % 3000U);
+            else model_cancel(m);
+        }
+        g_calls++;
+        tw_tick(&g_wheel);
+        if ((k & 1023) == 0) check_model(&bad_pending, &bad_remaining);
+    }
+    check_model(&bad_pending, &bad_remaining);
+    for (int i = 0; i < TIMERS; i++) if (g_m[i].pending && g_m[i].due <= g_calls) missed++;
+    CHECK_EQ(g_early, 0);
+    CHECK_EQ(g_late, 0);
+    CHECK_EQ(g_stray, 0);
+    CHECK_EQ(missed, 0);
+    CHECK_EQ(bad_pending, 0);
+    CHECK_EQ(bad_remaining, 0);
+    CHECK(g_fires > 1000);
+    printf("  시작 틱 0x%08X, tw_tick %llu 번: 콜백 %u 번, 빠름 %u, 늦음 %u, 엉뚱한 콜백 %u, 놓침 %u\n",
+           (unsigned)start, (unsigned long long)ticks, (unsigned)g_fires, (unsigned)g_early, (unsigned)g_late,
+           (unsigned)g_stray, (unsigned)missed);
+}
+
+// ■ 정확한 만료 틱 (delay 0 / 1 / N, 레벨 경계, 가장 먼 슬롯 너머)
+static uint32_t g_fired_at;
+static void mark(tw_timer_t *timer, void *arg) {
+    (void)timer;
+    g_fired_at = *(uint32_t *)arg;
+}
+
+static void test_exact(void) {
+    static const uint32_t delays[] = { 0, 1, 2, 63, 64, 65, 4095, 4096, 4097, 262143, 262144, 262145,
+                                       TW_MAX_DELTA_TICKS, TW_MAX_DELTA_TICKS + 1U, TW_MAX_DELTA_TICKS + 1000U };
+    static const uint32_t starts[] = { 0, 1, 63, 0xFFFFFFFFU, 0xFFFFFFC1U, 0xFFFF0000U };
+    uint32_t bad = 0, bad_remaining = 0;
+    static tw_timer_t t;
+    uint32_t calls = 0;
+    for (unsigned s = 0; s < sizeof(starts) / sizeof(starts[0]); s++) {
+        for (unsigned d = 0; d < sizeof(delays) / sizeof(delays[0]); d++) {
+            tw_init(&g_wheel, starts[s]);
+            tw_timer_init(&t, mark, &calls);
+            tw_start(&g_wheel, &t, delays[d], 0);
+            uint32_t expect = delays[d] ? delays[d] : 1U;
+            if (tw_remaining(&g_wheel, &t) != expect) bad_remaining++;
+            g_fired_at = 0;
+            for (calls = 1; calls <= expect + 5U && g_fired_at == 0; calls++) tw_tick(&g_wheel);
+            if (g_fired_at != expect) {
+                bad++;
+                printf("  시작 0x%08X, delay %u: %u 번째 tw_tick 에서 만료\n", (unsigned)starts[s],
+                       (unsigned)delays[d], (unsigned)g_fired_at);
+            }
+            if (tw_pending(&t)) bad++;
+        }
+    }
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(bad_remaining, 0);
+}
+
+static void nop(tw_timer_t *timer, void *arg) {
+    (void)timer; (void)arg;
+}
+
+static void bench(void) {
+    static tw_timer_t timers[10000];
+    static const uint32_t counts[] = { 0, 100, 10000 };
+    printf("  대기 중 타이머 | tw_tick (ns) | tw_start (ns)  (PC)\n");
+    for (unsigned c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        tw_init(&g_wheel, 0);
+        srand(9);
+        for (uint32_t i = 0; i < counts[c]; i++) {
+            tw_timer_init(&timers[i], nop, NULL);
+            tw_start(&g_wheel, &timers[i], 1U + (uint32_t)rand() % 10000U, 1U + (uint32_t)rand() % 10000U);
+        }
+        const uint32_t ticks = 2000000;
+        uint64_t t0 = now_ns();
+        for (uint32_t k = 0; k < ticks; k++) tw_tick(&g_wheel);
+        uint64_t t1 = now_ns();
+        const uint32_t starts = 2000000;
+        static tw_timer_t probe;
+        tw_timer_init(&probe, nop, NULL);
+        uint64_t t2 = now_ns();
+        for (uint32_t k = 0; k < starts; k++) tw_start(&g_wheel, &probe, 1U + (k * 2654435761U) % 100000U, 0);
+        uint64_t t3 = now_ns();
+        g_test_sink += tw_remaining(&g_wheel, &probe);
+        printf("  %14u | %12.1f | %13.1f\n", (unsigned)counts[c], (double)(t1 - t0) / ticks, (double)(t3 - t2) / starts);
+    }
+}
+
+int main(void) {
+    srand(22);
+    test_exact();
+    test_random(0, 3000000, 5000);
+    test_random(0xFFFFFFFFU - 1500000U, 3000000, 300000);  // 도중에 32비트 넘어감, 레벨 3 까지
+    test_random(0xFFFFFFFFU - 20000000U, 40000000, 300000); // 가장 먼 슬롯 너머 (TW_MAX_DELTA) 타이머도 만료까지
+    bench();
+    return TEST_END();
+}
@@ -0,0 +1,130 @@
+/***
+ 송신 포맷터 (tx_msg_*) vs 예전 snprintf 경로 호스트 비교
+ - 출력: uart_write() 형태 ("%s: %u\r\n\033[0m", "%s\r\n\033[0m") 와 write_time() 형태 ("\033[A\r\033[K%02u:%02u") 가
+         snprintf 결과와 바이트 단위로 같은지 (변수 전체 범위 0~65535, 분/초 0~99/0~59)
+ - 속도: 한 줄당 시간 (ns, PC) 예전 경로 = snprintf 로 버퍼에 쓰고 strlen, 새 경로 = 링버퍼에 바로 작성
+   (펌웨어의 코드 크기 비교는 Debug/DHT11_Demo.map 기준, 커밋 설명 참고)
+ ***/
+#include "test_util.h"
+#include <string.h>
+#include "uart_tx.h"
+
+#define UART_TX_BUF_SIZE 128 // 예전 g_tx_buffer 크기
+#define NO_VAR 65535
+
+static fsp_err_t fake_write(uart_ctrl_t * const p_ctrl, uint8_t const * const p_src, uint32_t const bytes) {
+    (void)p_ctrl; (void)p_src; (void)bytes;
+    return FSP_ERR_IN_USE; // 송신은 하지 않음 (링버퍼에서 직접 꺼내서 비교)
+}
+
+static const uart_api_t g_fake_api = { .write = fake_write };
+static const uart_instance_t g_fake_uart = { .p_ctrl = NULL, .p_cfg = NULL, .p_api = &g_fake_api };
+
+static uart_tx_ring_t g_tx;
+static char g_tx_buffer[UART_TX_BUF_SIZE];
+
+// ■ 예전 uart_write() 의 포맷 부분
+static size_t old_uart_format(const char *message, uint16_t var) {
+    if (var == NO_VAR) snprintf(g_tx_buffer, UART_TX_BUF_SIZE, "%s\r\n\033[0m", message);
+    else snprintf(g_tx_buffer, UART_TX_BUF_SIZE, "%s: %u\r\n\033[0m", message, var);
+    return strlen(g_tx_buffer);
+}
+
+// ■ 새 uart_write() 의 포맷 부분
+static uint16_t new_uart_format(const char *message, uint16_t var) {
+    uart_tx_msg_t msg;
+    tx_msg_begin(&g_tx, &msg);
+    tx_msg_str(&msg, message);
+    if (var != NO_VAR) {
+        tx_msg_str(&msg, ": ");
+        tx_msg_uint(&msg, var, 0);
+    }
+    tx_msg_str(&msg, "\r\n\033[0m");
+    uint16_t len = msg.len;
+    tx_msg_end(&msg);
+    return len;
+}
+
+// ■ 새 write_time() 의 포맷 부분
+static uint16_t new_time_format(uint32_t minutes, uint32_t seconds) {
+    uart_tx_msg_t msg;
+    tx_msg_begin(&g_tx, &msg);
+    tx_msg_str(&msg, "\033[A\r\033[K");
+    tx_msg_uint(&msg, minutes, 2);
+    tx_msg_str(&msg, ":");
+    tx_msg_uint(&msg, seconds, 2);
+    uint16_t len = msg.len;
+    tx_msg_end(&msg);
+    return len;
+}
+
+// ■ 마지막 메시지가 기대값과 같은지 (링버퍼에서 직접 비교 후 비움)
+static int ring_equals(const char *expect, uint16_t len) {
+    int ok = (strlen(expect) == len);
+    uint16_t start = (uint16_t)(g_tx.head - len);
+    for (uint16_t i = 0; ok && i < len; i++) {
+        ok = (g_tx.buffer[(uint16_t)(start + i) & UART_TX_RING_MASK] == (uint8_t)expect[i]);
+    }
+    g_tx.tail = g_tx.head;
+    return ok;
+}
+
+static void test_same_output(void) {
+    static const char *messages[] = {
+        "\033[36m조도 ADC 값", "\033[32m밝기", "", "\033[37;41m알 수 없는 명령어입니다.",
+    };
+    uart_tx_init(&g_tx, &g_fake_uart);
+    uint32_t bad = 0;
+    for (unsigned m = 0; m < sizeof(messages) / sizeof(messages[0]); m++) {
+        for (uint32_t var = 0; var <= NO_VAR; var++) {
+            old_uart_format(messages[m], (uint16_t)var);
+            if (!ring_equals(g_tx_buffer, new_uart_format(messages[m], (uint16_t)var))) bad++;
+        }
+    }
+    CHECK_EQ(bad, 0);
+    bad = 0;
+    for (uint32_t mm = 0; mm < 100; mm++) {
+        for (uint32_t ss = 0; ss < 60; ss++) {
+            snprintf(g_tx_buffer, sizeof(g_tx_buffer), "\033[A\r\033[K%02u:%02u", mm, ss);
+            if (!ring_equals(g_tx_buffer, new_time_format(mm, ss))) bad++;
+        }
+    }
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(g_tx.dropped, 0);
+}
+
+static void bench(void) {
+    const char *message = "\033[36m조도 ADC 값";
+    const uint32_t reps = 2000000;
+    uart_tx_init(&g_tx, &g_fake_uart);
+
+    uint64_t t0 = now_ns();
+    for (uint32_t i = 0; i < reps; i++) g_test_sink += (uint32_t)old_uart_format(message, (uint16_t)(i & 4095U));
+    uint64_t t1 = now_ns();
+    for (uint32_t i = 0; i < reps; i++) {
+        g_test_sink += new_uart_format(message, (uint16_t)(i & 4095U));
+        g_tx.tail = g_tx.head;
+    }
+    uint64_t t2 = now_ns();
+    for (uint32_t i = 0; i < reps; i++) {
+        snprintf(g_tx_buffer, sizeof(g_tx_buffer), "\033[A\r\033[K%02u:%02u", (i >> 6) % 100U, i % 60U);
+        g_test_sink += (uint32_t)strlen(g_tx_buffer);
+    }
+    uint64_t t3 = now_ns();
+    for (uint32_t i = 0; i < reps; i++) {
+        g_test_sink += new_time_format((i >> 6) % 100U, i % 60U);
+        g_tx.tail = g_tx.head;
+    }
+    uint64_t t4 = now_ns();
+
+    double old_log = (double)(t1 - t0) / reps, new_log = (double)(t2 - t1) / reps;
+    double old_time = (double)(t3 - t2) / reps, new_time = (double)(t4 - t3) / reps;
+    printf("  로그 한 줄  : snprintf %.1f ns, tx_msg %.1f ns (%.1f 배)\n", old_log, new_log, old_log / new_log);
+    printf("  mm:ss 한 줄 : snprintf %.1f ns, tx_msg %.1f ns (%.1f 배)\n", old_time, new_time, old_time / new_time);
+}
+
+int main(void) {
+    test_same_output();
+    bench();
+    return TEST_END();
+}
@@ -0,0 +1,227 @@
+/***
+ 토큰 로그 (uart_tx_log, UART_LOG_TOKENIZED) 호스트 검사
+ - 문자열: hal_entry.c 의 uart_write("...") / 명령어 표 도움말 문자열 전부 (소스에서 읽어서 가짜 rodata 이미지에 배치)
+ - 같은 로그 순서를 토큰 모드 / 텍스트 모드로 각각 링버퍼에 쓰고, 사이사이에 write_time() 형태의 텍스트 출력을 섞음
+ - 이미지를 ELF32 (PROGBITS+ALLOC 섹션 하나) 로 쓰고 tools/uart_log_decode.py 로 토큰 캡처를 풀어서
+   텍스트 모드 캡처와 바이트 단위로 같은지 확인 (python3 가 없으면 이 항목만 건너뜀)
+ - 이미지에 없는 주소의 토큰은 "<알 수 없는 토큰 0x......>" 로 표시되는지
+ - 결과: 송신 바이트 수, 115200bps 송신 시간, 한 줄당 포맷 시간 (ns, PC) 비교
+ ***/
+#include "test_util.h"
+#include <stdlib.h>
+#include <string.h>
+#include "uart_tx.h"
+
+#define MAX_MESSAGES 256
+#define IMAGE_SIZE 16384
+#define CAPTURE_SIZE 65536
+#define BAUD 115200U
+#define SESSION_ROUNDS 6 // 토큰 캡처가 4096 바이트를 넘게
+
+static fsp_err_t fake_write(uart_ctrl_t * const p_ctrl, uint8_t const * const p_src, uint32_t const bytes) {
+    (void)p_ctrl; (void)p_src; (void)bytes;
+    return FSP_ERR_IN_USE; // 송신은 하지 않음 (링버퍼에서 직접 꺼냄)
+}
+
+static const uart_api_t g_fake_api = { .write = fake_write };
+static const uart_instance_t g_fake_uart = { .p_ctrl = NULL, .p_cfg = NULL, .p_api = &g_fake_api };
+
+static uart_tx_ring_t g_tx;
+
+// 가짜 rodata: 토큰 주소는 하위 24비트만 보내므로, 24비트 경계를 넘지 않는 쪽을 사용
+static char g_image_area[2][IMAGE_SIZE];
+static char *g_image;
+static uint32_t g_image_used;
+static const char *g_messages[MAX_MESSAGES];
+static unsigned g_message_count;
+
+typedef struct {
+    uint8_t data[CAPTURE_SIZE];
+    uint32_t len;
+} capture_t;
+
+static capture_t g_token_capture;
+static capture_t g_text_capture;
+
+// ■ 링버퍼에 쌓인 바이트를 캡처로 옮김 (송신 완료 흉내)
+static void drain(capture_t *capture) {
+    while (g_tx.tail != g_tx.head) {
+        if (capture->len < CAPTURE_SIZE) capture->data[capture->len++] = g_tx.buffer[g_tx.tail & UART_TX_RING_MASK];
+        g_tx.tail++;
+    }
+}
+
+// ■ C 문자열 상수 하나를 이미지에 추가 (\033, \\, \", \r, \n 만 처리)
+static const char *add_literal(const char *p, const char **end) {
+    char *out = g_image + g_image_used;
+    uint32_t n = 0;
+    p++; // 여는 "
+    while (*p != '\0' && *p != '"') {
+        char c = *p++;
+        if (c == '\\') {
+            c = *p++;
+            if (c == 'r') c = '\r';
+            else if (c == 'n') c = '\n';
+            else if (c >= '0' && c <= '7') {
+                int value = c - '0';
+                for (int k = 0; k < 2 && *p >= '0' && *p <= '7'; k++) value = value * 8 + (*p++ - '0');
+                c = (char)value;
+            }
+        }
+        out[n++] = c;
+    }
+    out[n++] = '\0';
+    *end = (*p == '"') ? p + 1 : p;
+    g_image_used += n;
+    return out;
+}
+
+// ■ hal_entry.c 에서 uart_write 줄과 명령어 표 줄의 문자열 상수를 모음
+static void load_messages(void) {
+    uintptr_t first = (uintptr_t)g_image_area[0];
+    g_image = ((first & 0xFFFFFFu) + IMAGE_SIZE <= 0x1000000u) ? g_image_area[0] : g_image_area[1];
+    g_image_used = 16; // 주소 0 근처는 비워둠 (모르는 토큰 검사용)
+
+    FILE *f = fopen("../src/hal_entry.c", "r");
+    CHECK(f != NULL);
+    if (f == NULL) return;
+    char line[512];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        const char *p = strstr(line, "uart_write(");
+        _Bool table = (strncmp(line, "    X(\"", 7) == 0);
+        if (p == NULL && !table) continue;
+        if (table) p = strrchr(line, ',');       // 표는 마지막 칸(도움말)만
+        else if (strncmp(line, "void uart_write", 15) == 0) continue;
+        while ((p = strchr(p, '"')) != NULL && g_message_count < MAX_MESSAGES && g_image_used + 512 < IMAGE_SIZE) {
+            g_messages[g_message_count++] = add_literal(p, &p);
+        }
+    }
+    fclose(f);
+}
+
+static uint16_t message_var(unsigned i) {
+    return (i % 3 == 0) ? UART_TX_NO_VAR : (uint16_t)((i * 2654435761u) >> 20);
+}
+
+// ■ 같은 순서로 로그 + write_time() 형태 텍스트를 출력
+static void run_session(capture_t *capture, _Bool tokenized, unsigned rounds) {
+    uart_tx_init(&g_tx, &g_fake_uart);
+    capture->len = 0;
+    for (unsigned r = 0; r < rounds; r++) {
+        for (unsigned i = 0; i < g_message_count; i++) {
+            CHECK(uart_tx_log(&g_tx, g_messages[i], message_var(i + r), tokenized));
+            drain(capture);
+            if (i % 16 == 15) {
+                // write_time(): 토큰화하지 않는 텍스트 출력 (커서 이동 + mm:ss)
+                uart_tx_msg_t msg;
+                tx_msg_begin(&g_tx, &msg);
+                tx_msg_str(&msg, "\033[A\r\033[K");
+                tx_msg_uint(&msg, r, 2);
+                tx_msg_str(&msg, ":");
+                tx_msg_uint(&msg, i % 60, 2);
+                CHECK(tx_msg_end(&msg));
+                drain(capture);
+            }
+        }
+    }
+}
+
+static void write_u16(FILE *f, uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); }
+static void write_u32(FILE *f, uint32_t v) { write_u16(f, (uint16_t)v); write_u16(f, (uint16_t)(v >> 16)); }
+
+// ■ 이미지를 섹션 하나짜리 ELF32 LE 로 저장 (디코더가 읽는 부분만)
+static void write_elf(const char *path) {
+    FILE *f = fopen(path, "wb");
+    CHECK(f != NULL);
+    if (f == NULL) return;
+    uint32_t data_offset = 52;
+    uint32_t shoff = data_offset + ((IMAGE_SIZE + 3u) & ~3u);
+    static const uint8_t ident[16] = { 0x7F, 'E', 'L', 'F', 1, 1, 1, 0 };
+    fwrite(ident, 1, sizeof(ident), f);
+    write_u16(f, 2);  write_u16(f, 40);            // e_type EXEC, e_machine ARM
+    write_u32(f, 1);  write_u32(f, 0); write_u32(f, 0); write_u32(f, shoff); write_u32(f, 0);
+    write_u16(f, 52); write_u16(f, 0); write_u16(f, 0);
+    write_u16(f, 40); write_u16(f, 2); write_u16(f, 0); // e_shentsize, e_shnum, e_shstrndx
+    fwrite(g_image, 1, IMAGE_SIZE, f);
+    for (uint32_t i = 0; i < 40; i++) fputc(0, f); // 섹션 0 (NULL)
+    write_u32(f, 0); write_u32(f, 1); write_u32(f, 2); // sh_name, PROGBITS, ALLOC
+    write_u32(f, (uint32_t)((uintptr_t)g_image & 0xFFFFFFu));
+    write_u32(f, data_offset); write_u32(f, IMAGE_SIZE);
+    write_u32(f, 0); write_u32(f, 0); write_u32(f, 4); write_u32(f, 0);
+    fclose(f);
+}
+
+static void write_file(const char *path, const uint8_t *data, uint32_t len) {
+    FILE *f = fopen(path, "wb");
+    CHECK(f != NULL);
+    if (f == NULL) return;
+    fwrite(data, 1, len, f);
+    fclose(f);
+}
+
+static void test_decode(void) {
+    // 이미지 밖 주소 토큰 하나 추가 (텍스트 쪽에는 디코더가 내야 할 문장을 추가)
+    uart_tx_init(&g_tx, &g_fake_uart);
+    CHECK(uart_tx_log(&g_tx, g_image + 1, 7, true)); // 이미지 안이지만 NUL 만 있는 자리 > 빈 문자열
+    drain(&g_token_capture);
+    CHECK(uart_tx_log(&g_tx, "", 7, false));
+    drain(&g_text_capture);
+    uint8_t bogus[UART_TX_TOKEN_LEN] = { UART_TX_TOKEN_SYNC, 0x00, 0x00, 0x00, 0xFF, 0xFF };
+    uint32_t bogus_address = (uint32_t)(((uintptr_t)g_image & 0xFFFFFFu) + IMAGE_SIZE) & 0xFFFFFFu;
+    bogus[1] = (uint8_t)bogus_address; bogus[2] = (uint8_t)(bogus_address >> 8); bogus[3] = (uint8_t)(bogus_address >> 16);
+    memcpy(&g_token_capture.data[g_token_capture.len], bogus, sizeof(bogus));
+    g_token_capture.len += (uint32_t)sizeof(bogus);
+    g_text_capture.len += (uint32_t)snprintf((char *)&g_text_capture.data[g_text_capture.len],
+                                             CAPTURE_SIZE - g_text_capture.len,
+                                             "<알 수 없는 토큰 0x%06X>\r\n\033[0m", (unsigned)bogus_address);
+    CHECK(g_token_capture.len > 4096); // 디코더가 4096 바이트씩 읽으므로 청크 경계를 넘는 토큰이 생김
+
+    write_elf("build/uart_log.elf");
+    write_file("build/uart_log.bin", g_token_capture.data, g_token_capture.len);
+    if (system("python3 --version > /dev/null 2>&1") != 0) {
+        printf("  python3 없음: 디코더 검사 건너뜀\n");
+        return;
+    }
+    CHECK_EQ(system("PYTHONIOENCODING=utf-8 python3 ../tools/uart_log_decode.py build/uart_log.elf build/uart_log.bin"
+                    " > build/uart_log.txt"), 0);
+
+    static uint8_t decoded[CAPTURE_SIZE];
+    FILE *f = fopen("build/uart_log.txt", "rb");
+    CHECK(f != NULL);
+    if (f == NULL) return;
+    size_t len = fread(decoded, 1, sizeof(decoded), f);
+    fclose(f);
+    CHECK_EQ(len, g_text_capture.len);
+    CHECK(len == g_text_capture.len && memcmp(decoded, g_text_capture.data, len) == 0);
+}
+
+// ■ 한 줄당 포맷 시간 (링버퍼에 쓰기까지, ns)
+static double bench(_Bool tokenized) {
+    enum { ROUNDS = 2000 };
+    uart_tx_init(&g_tx, &g_fake_uart);
+    uint64_t t0 = now_ns();
+    for (unsigned r = 0; r < ROUNDS; r++) {
+        for (unsigned i = 0; i < g_message_count; i++) {
+            g_test_sink += uart_tx_log(&g_tx, g_messages[i], message_var(i + r), tokenized);
+            g_tx.tail = g_tx.head;
+        }
+    }
+    return (double)(now_ns() - t0) / ((double)ROUNDS * g_message_count);
+}
+
+int main(void) {
+    load_messages();
+    CHECK(g_message_count > 50);
+    run_session(&g_token_capture, true, SESSION_ROUNDS);
+    run_session(&g_text_capture, false, SESSION_ROUNDS);
+    uint32_t token_bytes = g_token_capture.len, text_bytes = g_text_capture.len;
+    test_decode();
+
+    printf("  문자열 %u 개 (이미지 %u 바이트), 같은 로그 %u회 + 시각 출력\n", g_message_count, g_image_used, SESSION_ROUNDS);
+    printf("  송신 바이트: 텍스트 %u, 토큰 %u (%.1f%%), 115200bps 송신 시간 %.1f ms > %.1f ms\n",
+           text_bytes, token_bytes, 100.0 * token_bytes / text_bytes,
+           text_bytes * 10.0 * 1000.0 / BAUD, token_bytes * 10.0 * 1000.0 / BAUD);
+    printf("  한 줄 포맷 (PC): 텍스트 %.1f ns, 토큰 %.1f ns\n", bench(false), bench(true));
+    printf("  토큰화하지 않는 출력: write_time() (커서 + mm:ss), 바이너리 응답 (bin_send_reply)\n");
+    return TEST_END();
+}
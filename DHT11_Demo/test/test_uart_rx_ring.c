@@ -0,0 +1,162 @@
+/***
+ uart_rx_ring (수신 링버퍼) 호스트 스트레스 테스트
+ - 115200 baud 로 쉬지 않고 들어오는 명령어 스크립트 (붙여넣기) 를 가상 시간으로 흉내
+   UART 인터럽트: 1바이트 시간 (86.8 us) 마다 uart_rx_push()
+   main loop    : 종료 문자(\r) 까지 uart_rx_pop() 으로 꺼내고, 명령어마다 실행 시간만큼 멈춤 + 주기적으로 긴 정지
+ - 링버퍼 크기 (256 바이트 = 22 ms) 안의 정지: 명령어를 하나도 잃지 않고 순서대로 받음
+ - 그보다 긴 정지: 버린 바이트 수 == overrun, 받은 바이트 == 버리지 않은 바이트 (순서 그대로)
+ - 무작위 끼어들기: 참조 큐와 바이트 단위로 비교 (head/tail 16비트 넘어감 포함)
+ ***/
+#include "test_util.h"
+#include <stdlib.h>
+#include <string.h>
+#include "uart_rx_ring.h"
+
+#define BAUD 115200U
+#define BYTE_NS (10U * 1000000000ULL / BAUD)
+#define SCRIPT_MAX (1 << 20)
+
+static uart_rx_ring_t g_ring;
+static uint8_t g_script[SCRIPT_MAX];    // 보낸 바이트
+static uint8_t g_accepted[SCRIPT_MAX];  // 링버퍼에 들어간 바이트 (버려지지 않은 것)
+static uint8_t g_received[SCRIPT_MAX];  // main loop 가 꺼낸 바이트
+static uint32_t g_script_len;
+
+// ■ 명령어 스크립트 (실제 명령어 형식, 종료 문자 \r)
+static void make_script(uint32_t commands) {
+    static const char *samples[] = {
+        "HDRR50TAIL\r", "HDRG10F2000TAIL\r", "HDR R50;G10;B40 TAIL\r", "HDRT10ONTAIL\r",
+        "HDRS3TAIL\r", "HDRATAIL\r", "HDRB255TAIL\r", "HDRH3000TAIL\r",
+    };
+    g_script_len = 0;
+    for (uint32_t i = 0; i < commands; i++) {
+        const char *cmd = samples[i % (sizeof(samples) / sizeof(samples[0]))];
+        size_t n = strlen(cmd);
+        memcpy(&g_script[g_script_len], cmd, n);
+        g_script_len += (uint32_t)n;
+    }
+}
+
+typedef struct {
+    uint32_t exec_us;       // 명령어 하나 실행 시간
+    uint32_t stall_every_ms;// 긴 정지 주기 (0: 없음)
+    uint32_t stall_ms;      // 긴 정지 시간
+} consumer_t;
+
+typedef struct {
+    uint32_t accepted;
+    uint32_t received;
+    uint32_t lines;
+    uint16_t max_used;
+} result_t;
+
+// ■ 가상 시간 시뮬레이션 (스크립트를 쉬지 않고 보냄)
+static result_t simulate(const consumer_t *c) {
+    result_t r = {0};
+    memset(&g_ring, 0, sizeof(g_ring));
+    g_ring.head = g_ring.tail = 0xFF00; // 16비트 넘어감도 거치게
+    uint64_t busy_until = 0;
+    uint64_t next_stall = (c->stall_every_ms != 0) ? (uint64_t)c->stall_every_ms * 1000000ULL : UINT64_MAX;
+    uint64_t t = 0;
+    for (uint32_t i = 0; i < g_script_len || g_ring.head != g_ring.tail; i++, t += BYTE_NS) {
+        // UART 인터럽트: 1바이트 수신
+        if (i < g_script_len && uart_rx_push(&g_ring, g_script[i])) g_accepted[r.accepted++] = g_script[i];
+        uint16_t used = (uint16_t)(g_ring.head - g_ring.tail);
+        if (used > r.max_used) r.max_used = used;
+
+        // main loop
+        if (t >= next_stall) {
+            busy_until = t + (uint64_t)c->stall_ms * 1000000ULL;
+            next_stall += (uint64_t)c->stall_every_ms * 1000000ULL;
+        }
+        if (t < busy_until) continue;
+        uint8_t data;
+        while (uart_rx_pop(&g_ring, &data)) {
+            g_received[r.received++] = data;
+            if (data == '\r') {
+                r.lines++;
+                busy_until = t + (uint64_t)c->exec_us * 1000ULL; // 명령어 실행
+                break;
+            }
+        }
+    }
+    return r;
+}
+
+// ■ 정지가 링버퍼 크기 안이면 잃는 명령어 없음
+static void test_no_loss(void) {
+    make_script(20000);
+    static const consumer_t cases[] = {
+        {  50, 100, 15 },   // 명령어 50 us + 100 ms 마다 15 ms 정지 (173 바이트)
+        { 500,   0,  0 },   // 명령어 0.5 ms (가장 짧은 명령어 10 바이트 = 0.87 ms 보다 짧음)
+        {  20,  50, 20 },   // 20 ms 정지 (230 바이트)
+    };
+    for (unsigned k = 0; k < sizeof(cases) / sizeof(cases[0]); k++) {
+        result_t r = simulate(&cases[k]);
+        CHECK_EQ(g_ring.overrun, 0);
+        CHECK_EQ(r.accepted, g_script_len);
+        CHECK_EQ(r.received, g_script_len);
+        CHECK_EQ(r.lines, 20000);
+        CHECK(memcmp(g_received, g_script, g_script_len) == 0);
+        printf("  실행 %u us, %u ms 마다 %u ms 정지: %u 바이트 / 명령어 %u 개, 최대 사용 %u/%u, 오버런 %u\n",
+               cases[k].exec_us, cases[k].stall_every_ms, cases[k].stall_ms, (unsigned)g_script_len,
+               (unsigned)r.lines, r.max_used, UART_RX_RING_SIZE, (unsigned)g_ring.overrun);
+    }
+}
+
+// ■ 링버퍼보다 긴 정지: 버린 만큼 정확히 overrun, 받은 데이터는 버리지 않은 바이트 그대로
+static void test_overrun_accounting(void) {
+    make_script(5000);
+    static const consumer_t cases[] = {
+        { 50, 100, 40 },    // 40 ms 정지 (460 바이트)
+        { 2000, 0, 0 },     // 명령어 2 ms (수신보다 느림 > 계속 넘침)
+    };
+    for (unsigned k = 0; k < sizeof(cases) / sizeof(cases[0]); k++) {
+        result_t r = simulate(&cases[k]);
+        CHECK(g_ring.overrun > 0);
+        CHECK_EQ(r.accepted + g_ring.overrun, g_script_len);
+        CHECK_EQ(r.received, r.accepted);
+        CHECK(memcmp(g_received, g_accepted, r.accepted) == 0);
+        CHECK_EQ(r.max_used, UART_RX_RING_SIZE);
+        printf("  실행 %u us, %u ms 마다 %u ms 정지: 보냄 %u, 받음 %u, 오버런 %u (합 일치)\n",
+               cases[k].exec_us, cases[k].stall_every_ms, cases[k].stall_ms, (unsigned)g_script_len,
+               (unsigned)r.received, (unsigned)g_ring.overrun);
+    }
+}
+
+// ■ 무작위 끼어들기: 참조 큐와 비교
+static void test_random(void) {
+    memset(&g_ring, 0, sizeof(g_ring));
+    srand(12345);
+    uint32_t ref_head = 0, ref_tail = 0, ref_overrun = 0;   // 참조 큐 (g_script 를 저장소로)
+    uint32_t sent = 0;
+    uint32_t bad = 0;
+    while (sent < SCRIPT_MAX / 2) {
+        int pushes = rand() % 300;
+        for (int i = 0; i < pushes; i++) {
+            uint8_t v = (uint8_t)rand();
+            sent++;
+            if (ref_head - ref_tail < UART_RX_RING_SIZE) g_script[ref_head++ % SCRIPT_MAX] = v;
+            else ref_overrun++;
+            uart_rx_push(&g_ring, v);
+        }
+        int pops = rand() % 300;
+        for (int i = 0; i < pops; i++) {
+            uint8_t v;
+            _Bool got = uart_rx_pop(&g_ring, &v);
+            if (got != (ref_tail != ref_head)) bad++;
+            if (!got) break;
+            if (v != g_script[ref_tail++ % SCRIPT_MAX]) bad++;
+        }
+    }
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(g_ring.overrun, ref_overrun);
+    CHECK_EQ((uint16_t)(g_ring.head - g_ring.tail), ref_head - ref_tail);
+}
+
+int main(void) {
+    test_no_loss();
+    test_overrun_accounting();
+    test_random();
+    return TEST_END();
+}
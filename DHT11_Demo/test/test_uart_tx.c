@@ -0,0 +1,357 @@
+/***
+ uart_tx (송신 링버퍼 + 포맷터) 호스트 테스트
+ - 가짜 UART (uart_api_t 의 write 만 구현): 송신 요청을 기록하고, 115200 baud 속도로 가상 시간에 송신 완료
+ - 기능: 순서, 버퍼 끝 넘어감(2번에 나눠 송신), 공간 부족 시 메시지 통째로 버림 + dropped, max_used, write 실패 재시도
+ - DTC 모드: 가짜 r_sci_uart (open 에서 p_transfer_tx 를 열고, write 에서 reset 으로 넘김) + 가짜 전송 인스턴스
+   구간마다 인터럽트 수 (DTC: 2번, TXI: 바이트 수 + 1번), 전송 인스턴스 열기 실패 시 TXI 방식으로 되돌아감
+ - 지연: 예전 방식 (R_SCI_UART_Write 후 송신 완료까지 대기) 의 메인 루프 정지 시간과
+         링버퍼 방식의 호출 비용 (PC 에서 측정) 을 로그 양 1/4/16/64 개 (100 ms 마다) 로 비교
+ ***/
+#include "test_util.h"
+#include <string.h>
+#include "uart_tx.h"
+
+#define BAUD 115200U
+#define BYTE_NS (10U * 1000000000ULL / BAUD) // 1바이트 = 10비트 (start + 8 + stop)
+
+/*** 가짜 전송 인스턴스 (r_dtc 대신) ***/
+typedef struct {
+    uint32_t opens;
+    uint32_t resets;
+    fsp_err_t open_result;  // open 반환값 (실패 흉내)
+    const uint8_t *src;     // reset 으로 받은 송신 구간
+    uint16_t length;
+} fake_transfer_t;
+
+static fake_transfer_t g_dtc;
+
+static fsp_err_t fake_transfer_open(transfer_ctrl_t * const p_ctrl, transfer_cfg_t const * const p_cfg) {
+    (void)p_ctrl; (void)p_cfg;
+    g_dtc.opens++;
+    return g_dtc.open_result;
+}
+
+static fsp_err_t fake_transfer_reset(transfer_ctrl_t * const p_ctrl, void const * p_src, void * p_dest,
+                                     uint16_t const num_transfers) {
+    (void)p_ctrl; (void)p_dest;
+    g_dtc.resets++;
+    g_dtc.src = p_src;
+    g_dtc.length = num_transfers;
+    return FSP_SUCCESS;
+}
+
+static const transfer_api_t g_fake_transfer_api = { .open = fake_transfer_open, .reset = fake_transfer_reset };
+static transfer_info_t g_fake_transfer_info;
+static const transfer_cfg_t g_fake_transfer_cfg = { .p_info = &g_fake_transfer_info, .p_extend = NULL };
+static const transfer_instance_t g_fake_transfer = { .p_ctrl = NULL, .p_cfg = &g_fake_transfer_cfg,
+                                                     .p_api = &g_fake_transfer_api };
+
+/*** 가짜 UART (r_sci_uart 의 송신 동작만 흉내) ***/
+typedef struct {
+    uint8_t out[1 << 16];   // 지금까지 송신된 바이트 (순서대로)
+    uint32_t out_len;
+    const uint8_t *src;     // 송신 중인 구간
+    uint32_t bytes;
+    uint64_t done_ns;       // 송신 완료 시각 (가상 시간)
+    uint32_t writes;        // write 호출 횟수
+    uint32_t fail_next;     // 1 이면 다음 write 를 실패시킴
+    uint32_t irqs;          // 송신 인터럽트 수 (TXI + TEI)
+    uart_cfg_t const *cfg;  // open 으로 받은 설정 (드라이버처럼 포인터만 보관)
+} fake_uart_t;
+
+static fake_uart_t g_fake;
+static uint64_t g_now_ns;   // 가상 시간
+
+static fsp_err_t fake_open(uart_ctrl_t * const p_ctrl, uart_cfg_t const * const p_cfg) {
+    (void)p_ctrl;
+    if (p_cfg->p_transfer_tx != NULL) {
+        // r_sci_uart_transfer_open: 전송 인스턴스를 열지 못하면 UART 도 열지 않음
+        fsp_err_t err = p_cfg->p_transfer_tx->p_api->open(p_cfg->p_transfer_tx->p_ctrl, p_cfg->p_transfer_tx->p_cfg);
+        if (err != FSP_SUCCESS) return err;
+    }
+    g_fake.cfg = p_cfg;
+    return FSP_SUCCESS;
+}
+
+static fsp_err_t fake_write(uart_ctrl_t * const p_ctrl, uint8_t const * const p_src, uint32_t const bytes) {
+    (void)p_ctrl;
+    if (g_fake.fail_next) {
+        g_fake.fail_next = 0;
+        return FSP_ERR_IN_USE;
+    }
+    if (g_fake.bytes != 0) return FSP_ERR_IN_USE; // r_sci_uart 와 같이, 송신 중이면 거부
+    if ((g_fake.cfg != NULL) && (g_fake.cfg->p_transfer_tx != NULL)) {
+        // DTC: 구간을 전송 인스턴스에 넘기고, 마지막 TXI + TEI 인터럽트만 발생
+        transfer_instance_t const *t = g_fake.cfg->p_transfer_tx;
+        t->p_api->reset(t->p_ctrl, p_src, NULL, (uint16_t)bytes);
+        g_fake.irqs += 2;
+    } else {
+        g_fake.irqs += bytes + 1; // 바이트마다 TXI + 마지막 TEI
+    }
+    g_fake.src = p_src;
+    g_fake.bytes = bytes;
+    g_fake.done_ns = g_now_ns + bytes * BYTE_NS;
+    g_fake.writes++;
+    return FSP_SUCCESS;
+}
+
+static const uart_api_t g_fake_api = { .open = fake_open, .write = fake_write };
+static const uart_cfg_t g_fake_uart_cfg = { .channel = 0, .p_transfer_tx = NULL };
+static const uart_instance_t g_fake_uart = { .p_ctrl = NULL, .p_cfg = &g_fake_uart_cfg, .p_api = &g_fake_api };
+
+static uart_tx_ring_t g_tx;
+
+// ■ 가상 시간 진행 (송신 완료되면 TX_COMPLETE 처리)
+static void advance_to(uint64_t t) {
+    while (g_fake.bytes != 0 && g_fake.done_ns <= t) {
+        g_now_ns = g_fake.done_ns;
+        const uint8_t *src = g_fake.src;
+        if ((g_fake.cfg != NULL) && (g_fake.cfg->p_transfer_tx != NULL)) {
+            CHECK_EQ(g_dtc.length, g_fake.bytes);
+            src = g_dtc.src; // DTC 가 보낸 데이터
+        }
+        memcpy(&g_fake.out[g_fake.out_len], src, g_fake.bytes);
+        g_fake.out_len += g_fake.bytes;
+        g_fake.bytes = 0;
+        uart_tx_complete(&g_tx); // UART_EVENT_TX_COMPLETE
+    }
+    if (t > g_now_ns) g_now_ns = t;
+}
+
+// ■ 남은 데이터 모두 송신
+static void drain(void) {
+    advance_to(UINT64_MAX - 1);
+}
+
+static void reset(void) {
+    memset(&g_fake, 0, sizeof(g_fake));
+    memset(&g_dtc, 0, sizeof(g_dtc));
+    g_now_ns = 0;
+    uart_tx_init(&g_tx, &g_fake_uart);
+}
+
+// ■ uart_write() 와 같은 형태의 로그 한 줄 (반환: 메시지 길이, 버려졌으면 0)
+static uint16_t log_line(const char *message, uint32_t var) {
+    uart_tx_msg_t msg;
+    tx_msg_begin(&g_tx, &msg);
+    tx_msg_str(&msg, message);
+    tx_msg_str(&msg, ": ");
+    tx_msg_uint(&msg, var, 0);
+    tx_msg_str(&msg, "\r\n\033[0m");
+    uint16_t len = msg.len;
+    return tx_msg_end(&msg) ? len : 0;
+}
+
+// ■ 순서 + 포맷
+static void test_order_format(void) {
+    reset();
+    uart_tx_msg_t msg;
+    tx_msg_begin(&g_tx, &msg);
+    tx_msg_str(&msg, "T ");
+    tx_msg_uint(&msg, 5, 2);
+    tx_msg_str(&msg, ":");
+    tx_msg_uint(&msg, 7, 2);
+    tx_msg_str(&msg, " ");
+    tx_msg_uint(&msg, 0, 0);
+    tx_msg_str(&msg, " ");
+    tx_msg_uint(&msg, 4294967295U, 0);
+    tx_msg_str(&msg, " ");
+    tx_msg_uint(&msg, 123, 2);
+    CHECK(tx_msg_end(&msg));
+    CHECK_EQ(g_fake.writes, 1); // 송신 중이 아니었으므로 바로 송신 시작
+    log_line("A", 1);
+    log_line("B", 2);
+    CHECK_EQ(g_fake.writes, 1); // 송신 중에는 링버퍼에만 쌓임
+    drain();
+    const char *expect = "T 05:07 0 4294967295 123" "A: 1\r\n\033[0m" "B: 2\r\n\033[0m";
+    CHECK_EQ(g_fake.out_len, strlen(expect));
+    CHECK(memcmp(g_fake.out, expect, strlen(expect)) == 0);
+    CHECK_EQ(g_fake.writes, 2); // 쌓인 두 줄은 TX_COMPLETE 에서 한 번에
+    CHECK_EQ(g_tx.head, g_tx.tail);
+}
+
+// ■ 버퍼 끝 넘어감: 연속 구간 두 번으로 나눠 송신, 내용은 그대로
+static void test_wrap(void) {
+    reset();
+    char line[64];
+    memset(line, 'x', sizeof(line) - 1);
+    line[sizeof(line) - 1] = '\0';
+    uint32_t expect_len = 0;
+    uint32_t seq = 0;
+    // 메시지 길이가 버퍼 크기의 약수가 아니므로 여러 번 버퍼 끝을 넘어감
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < 5; i++) {
+            uint16_t len = log_line(line + (seq % 40U), seq);
+            CHECK(len != 0);
+            expect_len += len;
+            seq++;
+        }
+        drain();
+    }
+    CHECK_EQ(g_fake.out_len, expect_len);
+    CHECK_EQ(g_tx.dropped, 0);
+    // 출력 검증: 같은 순서로 다시 만들어 비교
+    uint32_t pos = 0;
+    int ok = 1;
+    for (uint32_t i = 0; i < seq && ok; i++) {
+        char buf[128];
+        int n = snprintf(buf, sizeof(buf), "%s: %u\r\n\033[0m", line + (i % 40U), i);
+        ok = (memcmp(&g_fake.out[pos], buf, (size_t)n) == 0);
+        pos += (uint32_t)n;
+    }
+    CHECK(ok);
+    CHECK(g_fake.writes > 200); // 버퍼 끝에서 나눈 송신 포함
+}
+
+// ■ 공간 부족: 메시지를 통째로 버리고 길이만큼 dropped, 이후 메시지는 정상
+static void test_overflow(void) {
+    reset();
+    char big[UART_TX_RING_SIZE / 2];
+    memset(big, 'a', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    uart_tx_msg_t msg;
+    tx_msg_begin(&g_tx, &msg);
+    tx_msg_str(&msg, big);
+    CHECK(tx_msg_end(&msg));            // 511
+    tx_msg_begin(&g_tx, &msg);
+    tx_msg_str(&msg, big);
+    CHECK(tx_msg_end(&msg));            // 1022 (송신 중이라 tail 은 그대로)
+    CHECK_EQ(g_tx.max_used, 2 * (sizeof(big) - 1));
+    tx_msg_begin(&g_tx, &msg);
+    tx_msg_str(&msg, "HELLO");          // 남은 공간 2바이트
+    CHECK(!tx_msg_end(&msg));
+    CHECK_EQ(g_tx.dropped, 5);          // 메시지 전체 길이
+    CHECK_EQ(g_tx.head, 2 * (sizeof(big) - 1)); // 일부도 반영되지 않음
+    drain();
+    CHECK(log_line("OK", 1) != 0);
+    drain();
+    CHECK_EQ(g_fake.out_len, 2 * (sizeof(big) - 1) + strlen("OK: 1\r\n\033[0m"));
+    CHECK(memcmp(&g_fake.out[g_fake.out_len - 11], "OK: 1\r\n\033[0m", 11) == 0);
+    CHECK_EQ(g_tx.max_used, 2 * (sizeof(big) - 1)); // 최대값 유지
+}
+
+// ■ write 실패: 다음 메시지 때 다시 송신
+static void test_write_fail(void) {
+    reset();
+    g_fake.fail_next = 1;
+    log_line("A", 1);
+    CHECK_EQ(g_fake.writes, 0);
+    CHECK_EQ(g_tx.sending, 0);
+    log_line("B", 2);
+    CHECK_EQ(g_fake.writes, 1);
+    drain();
+    CHECK_EQ(g_fake.out_len, 2 * strlen("A: 1\r\n\033[0m"));
+}
+
+// ■ 같은 로그를 보내고 인터럽트 수 비교 (transfer: 연결할 전송 인스턴스)
+static uint32_t run_mode(transfer_instance_t const *transfer, fsp_err_t transfer_open_result, _Bool *mode) {
+    reset();
+    g_dtc.open_result = transfer_open_result;
+    CHECK_EQ(uart_tx_open(&g_tx, transfer), FSP_SUCCESS);
+    *mode = g_tx.transfer_mode;
+    CHECK(g_fake.cfg == &g_tx.cfg);                        // 드라이버가 복사본을 참조
+    CHECK(g_fake_uart_cfg.p_transfer_tx == NULL);          // 원래 설정은 그대로
+    uint32_t bytes = 0;
+    for (uint32_t i = 0; i < 300; i++) {
+        bytes += log_line("\033[36m조도 ADC 값", i);
+        if (i % 7U == 0) drain();
+    }
+    drain();
+    CHECK_EQ(g_fake.out_len, bytes);
+    CHECK_EQ(g_tx.chunks, g_fake.writes);
+    return g_fake.irqs;
+}
+
+static void test_transfer(void) {
+    _Bool mode;
+    uint32_t irq_txi = run_mode(NULL, FSP_SUCCESS, &mode);
+    CHECK(!mode);
+    CHECK_EQ(g_dtc.opens, 0);
+    uint8_t out_txi[sizeof(g_fake.out)];
+    uint32_t len_txi = g_fake.out_len;
+    memcpy(out_txi, g_fake.out, len_txi);
+
+    uint32_t irq_dtc = run_mode(&g_fake_transfer, FSP_SUCCESS, &mode);
+    CHECK(mode);
+    CHECK_EQ(g_dtc.opens, 1);
+    CHECK_EQ(g_dtc.resets, g_tx.chunks);                   // 구간마다 전송 인스턴스 사용
+    CHECK_EQ(irq_dtc, 2 * g_tx.chunks);
+    CHECK_EQ(g_fake.out_len, len_txi);                      // 두 방식의 출력이 같음
+    CHECK(memcmp(g_fake.out, out_txi, len_txi) == 0);
+    printf("  로그 300줄 (%u 바이트): TXI 인터럽트 %u 번, DTC %u 번 (구간 %u 개)\n",
+           (unsigned)len_txi, (unsigned)irq_txi, (unsigned)irq_dtc, (unsigned)g_tx.chunks);
+
+    // 전송 인스턴스 열기 실패 > 연결 없이 다시 열어서 TXI 방식으로 동작
+    uint32_t irq_fallback = run_mode(&g_fake_transfer, FSP_ERR_ASSERTION, &mode);
+    CHECK(!mode);
+    CHECK_EQ(g_dtc.opens, 1);
+    CHECK_EQ(g_dtc.resets, 0);
+    CHECK(g_tx.cfg.p_transfer_tx == NULL);
+    CHECK_EQ(irq_fallback, irq_txi);
+}
+
+// ■ 지연: 로그 양에 따른 메인 루프 정지 시간 (대기 방식) vs 호출 비용 (링버퍼)
+static void bench_latency(void) {
+    static const uint16_t volumes[] = {1, 4, 16, 64};
+    const char *text = "\033[36m조도 ADC 값";
+    printf("  로그/100ms | 대기 방식 정지 (us) | 링버퍼 호출 (us, PC) | 링버퍼 드롭 (바이트/초)\n");
+    for (unsigned v = 0; v < sizeof(volumes) / sizeof(volumes[0]); v++) {
+        uint16_t n = volumes[v];
+
+        // 링버퍼 방식 호출 비용: 실제 코드 실행 시간 (송신은 즉시 끝난 것으로 보고 링버퍼를 비움)
+        const int reps = 20000;
+        reset();
+        uint64_t t0 = now_ns();
+        for (int r = 0; r < reps; r++) {
+            for (uint16_t i = 0; i < n; i++) {
+                g_test_sink += log_line(text, (uint32_t)r);
+                g_tx.tail = g_tx.head;
+                g_tx.sending = 0;
+                g_fake.bytes = 0;
+            }
+        }
+        uint64_t t1 = now_ns();
+        double call_us = (double)(t1 - t0) / reps / 1000.0;
+
+        // 100 ms 마다 n 줄, 1초 동안 가상 시간으로 실행 (115200 baud 로 비워짐)
+        reset();
+        uint32_t bytes = 0;
+        uint32_t sent_lines = 0;
+        for (uint32_t period = 0; period < 10U; period++) {
+            advance_to((uint64_t)period * 100000000ULL);
+            for (uint16_t i = 0; i < n; i++) {
+                uint16_t len = log_line(text, 1000U + i);
+                if (len != 0) {
+                    bytes += len;
+                    sent_lines++;
+                }
+            }
+        }
+        drain();
+        CHECK_EQ(g_fake.out_len, bytes);    // 반영된 메시지는 모두, 온전하게 송신됨
+        CHECK(g_tx.max_used <= UART_TX_RING_SIZE);
+        uint32_t line_len = (uint32_t)strlen(text) + 6U + 6U; // ": 1000" + "\r\n\033[0m"
+        // 대기 방식: 줄마다 송신 완료까지 정지 (1줄 = line_len 바이트)
+        double blocking_us = (double)n * line_len * (double)BYTE_NS / 1000.0;
+        printf("  %10u | %19.0f | %20.2f | %u\n", n, blocking_us, call_us, (unsigned)g_tx.dropped);
+
+        // 링버퍼(1024) 에 들어가는 양이면 드롭 없음, 넘치면 줄 단위로만 버림
+        if ((uint32_t)n * line_len <= UART_TX_RING_SIZE) {
+            CHECK_EQ(g_tx.dropped, 0);
+        } else {
+            CHECK(g_tx.dropped > 0);
+            CHECK_EQ(g_tx.dropped % line_len, 0);
+            CHECK_EQ(sent_lines * line_len + g_tx.dropped, 10U * n * line_len);
+        }
+    }
+}
+
+int main(void) {
+    test_order_format();
+    test_wrap();
+    test_overflow();
+    test_write_fail();
+    test_transfer();
+    bench_latency();
+    return TEST_END();
+}
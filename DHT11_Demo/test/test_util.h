@@ -0,0 +1,48 @@
+/***
+ 호스트 테스트 공통 (검사 매크로, 시간 측정)
+ - CHECK(조건): 실패하면 위치를 출력하고 실패 횟수 증가 (계속 진행)
+ - TEST_END(): 결과 출력, main 에서 return TEST_END();
+ - now_ns(): 단조 증가 시계 (벤치마크용, ns)
+ ***/
+#ifndef TEST_UTIL_H
+#define TEST_UTIL_H
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+static unsigned g_test_checks = 0;
+static unsigned g_test_fails = 0;
+
+#define CHECK(cond) do { \
+        g_test_checks++; \
+        if (!(cond)) { \
+            g_test_fails++; \
+            printf("  실패 %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        } \
+    } while (0)
+
+#define CHECK_EQ(a, b) do { \
+        long long check_a_ = (long long)(a), check_b_ = (long long)(b); \
+        g_test_checks++; \
+        if (check_a_ != check_b_) { \
+            g_test_fails++; \
+            printf("  실패 %s:%d: %s == %s (%lld != %lld)\n", __FILE__, __LINE__, #a, #b, check_a_, check_b_); \
+        } \
+    } while (0)
+
+#define TEST_END() \
+    (printf("  검사 %u 개, 실패 %u 개\n", g_test_checks, g_test_fails), (g_test_fails == 0) ? 0 : 1)
+
+// ■ 현재 시각 (ns)
+static inline uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// 최적화로 벤치마크 결과가 사라지지 않게 하는 변수
+static volatile uint32_t g_test_sink;
+
+#endif /* TEST_UTIL_H */
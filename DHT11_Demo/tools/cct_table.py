@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""
+색온도(CCT) > RGB 테이블 생성기 (src/cct_table.h 생성)
+
+color.c 의 color_cct_to_rgb() 가 이 테이블을 선형 보간해서 읽는다 (log/pow 계산 없음).
+색온도 > RGB 는 흑체 복사 색을 sRGB 로 근사한 Tanner Helland 의 식을 사용
+  (https://tannerhelland.com/2012/09/18/convert-temperature-rgb-algorithm-code.html)
+값은 Q12 (4096 = 1.0), color.h 의 COLOR_ONE 과 같아야 함
+
+사용 예)
+  python cct_table.py > ../src/cct_table.h
+  python cct_table.py --min 1500 --max 8000 --step 50 > ../src/cct_table.h
+"""
+import argparse
+import math
+
+COLOR_ONE = 4096    # color.h COLOR_ONE
+
+
+def cct_to_rgb(kelvin):
+    """Tanner Helland 근사 > (r, g, b) 0.0 ~ 1.0"""
+    t = kelvin / 100.0
+    if t <= 66:
+        r = 255.0
+        g = 99.4708025861 * math.log(t) - 161.1195681661
+    else:
+        r = 329.698727446 * (t - 60) ** -0.1332047592
+        g = 288.1221695283 * (t - 60) ** -0.0755148492
+    if t >= 66:
+        b = 255.0
+    elif t <= 19:
+        b = 0.0
+    else:
+        b = 138.5177312231 * math.log(t - 10) - 305.0447927307
+    return tuple(min(max(c, 0.0), 255.0) / 255.0 for c in (r, g, b))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='색온도 > RGB 테이블 생성')
+    parser.add_argument('--min', type=int, default=1000, help='최저 색온도 (K)')
+    parser.add_argument('--max', type=int, default=10000, help='최고 색온도 (K)')
+    parser.add_argument('--step', type=int, default=100, help='테이블 간격 (K)')
+    args = parser.parse_args()
+    if (args.max - args.min) % args.step:
+        parser.error('(max - min) 은 step 의 배수여야 함')
+
+    kelvins = range(args.min, args.max + 1, args.step)
+    print('/* tools/cct_table.py 로 생성 (직접 수정하지 말 것) */')
+    print('#ifndef CCT_TABLE_H')
+    print('#define CCT_TABLE_H')
+    print()
+    print('#define CCT_TABLE_MIN_K %d' % args.min)
+    print('#define CCT_TABLE_MAX_K %d' % args.max)
+    print('#define CCT_TABLE_STEP_K %d' % args.step)
+    print('#define CCT_TABLE_COUNT %d' % len(kelvins))
+    print('#define CCT_TABLE_ONE %d' % COLOR_ONE)
+    print()
+    print('// {R, G, B} (Q12), %dK ~ %dK, %dK 간격' % (args.min, args.max, args.step))
+    print('#define CCT_TABLE_VALUES \\')
+    for i, k in enumerate(kelvins):
+        rgb = [int(round(c * COLOR_ONE)) for c in cct_to_rgb(k)]
+        last = (i == len(kelvins) - 1)
+        print('    { %4d, %4d, %4d }%s /* %5dK */%s' % (rgb[0], rgb[1], rgb[2], '' if last else ',', k, '' if last else ' \\'))
+    print()
+    print('#endif /* CCT_TABLE_H */')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""
+조도센서 필터 계수 생성기 (src/light_filter_coeffs.h 생성)
+
+필터 구성 (ADC 샘플링 ADC_SAMPLE_RATE_HZ 기준):
+  1) 노치 (형광등/LED 조명 깜빡임: 전원 주파수의 2배, 60Hz 전원 > 120Hz)
+  2) 2차 버터워스 저역통과
+  3) FIR 데시메이션 (블록 크기만큼 평균 필터 후 1개만 남김)
+
+계수 형식은 CMSIS-DSP arm_biquad_cascade_df1_q31 / arm_fir_decimate_q31 과 같다.
+  biquad: 스테이지당 {b0, b1, b2, a1, a2} (a 는 부호 반전), 계수 = 실제값 / 2^post_shift
+  FIR   : 시간 역순 계수 (평균 필터는 대칭이라 순서 무관)
+
+사용 예)
+  python filter_coeffs.py > ../src/light_filter_coeffs.h
+  python filter_coeffs.py --fs 640 --notch 100 --lowpass 5 > ../src/light_filter_coeffs.h   (50Hz 전원)
+"""
+import argparse
+import math
+
+Q31_ONE = 1 << 31
+
+
+def to_q31(value, post_shift):
+    q = int(round(value / (1 << post_shift) * Q31_ONE))
+    if not -Q31_ONE <= q < Q31_ONE:
+        raise ValueError('계수가 Q31 범위를 벗어남 (post_shift 를 늘리세요): %f' % value)
+    return q
+
+
+def notch(fs, f0, q):
+    """RBJ 노치 > (b0, b1, b2, a1, a2) 정규화 (a0 = 1)"""
+    w0 = 2 * math.pi * f0 / fs
+    alpha = math.sin(w0) / (2 * q)
+    a0 = 1 + alpha
+    return (1 / a0, -2 * math.cos(w0) / a0, 1 / a0, -2 * math.cos(w0) / a0, (1 - alpha) / a0)
+
+
+def lowpass(fs, fc, q):
+    """RBJ 저역통과"""
+    w0 = 2 * math.pi * fc / fs
+    alpha = math.sin(w0) / (2 * q)
+    a0 = 1 + alpha
+    b1 = (1 - math.cos(w0)) / a0
+    return (b1 / 2, b1, b1 / 2, -2 * math.cos(w0) / a0, (1 - alpha) / a0)
+
+
+def biquad_q31(coeffs, post_shift):
+    b0, b1, b2, a1, a2 = coeffs
+    # CMSIS 형식: y = b0 x0 + b1 x1 + b2 x2 + a1' y1 + a2' y2  (a1' = -a1, a2' = -a2)
+    return [to_q31(c, post_shift) for c in (b0, b1, b2, -a1, -a2)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='조도센서 필터 계수 생성')
+    parser.add_argument('--fs', type=float, default=640, help='샘플링 주파수 (hal_entry.c ADC_SAMPLE_RATE_HZ)')
+    parser.add_argument('--notch', type=float, default=120, help='노치 주파수 (전원 주파수 x 2)')
+    parser.add_argument('--notch-q', type=float, default=2.0)
+    parser.add_argument('--lowpass', type=float, default=5, help='저역통과 차단 주파수')
+    parser.add_argument('--taps', type=int, default=64, help='FIR 탭 수 = 데시메이션 비율 (ADC_BLOCK_SIZE)')
+    parser.add_argument('--post-shift', type=int, default=1)
+    args = parser.parse_args()
+
+    stages = [('노치 %.0fHz Q%.1f' % (args.notch, args.notch_q), notch(args.fs, args.notch, args.notch_q)),
+              ('저역통과 %.0fHz 버터워스' % args.lowpass, lowpass(args.fs, args.lowpass, 1 / math.sqrt(2)))]
+    fir = to_q31(1.0 / args.taps, 0)
+
+    print('/* tools/filter_coeffs.py 로 생성 (직접 수정하지 말 것) */')
+    print('/* fs %.0fHz, %s */' % (args.fs, ', '.join(name for name, _ in stages)))
+    print('#ifndef LIGHT_FILTER_COEFFS_H')
+    print('#define LIGHT_FILTER_COEFFS_H')
+    print()
+    print('#define LIGHT_FILTER_FS_HZ %d' % round(args.fs))
+    print('#define LIGHT_FILTER_BIQUAD_STAGES %d' % len(stages))
+    print('#define LIGHT_FILTER_POST_SHIFT %d' % args.post_shift)
+    print('#define LIGHT_FILTER_FIR_TAPS %d' % args.taps)
+    print('#define LIGHT_FILTER_DECIMATION %d' % args.taps)
+    print()
+    print('// 스테이지당 {b0, b1, b2, a1, a2} (Q31, / 2^post_shift)')
+    print('#define LIGHT_FILTER_BIQUAD_COEFFS \\')
+    for i, (name, coeffs) in enumerate(stages):
+        q = biquad_q31(coeffs, args.post_shift)
+        end = ', \\' if i < len(stages) - 1 else ''
+        print('    %s /* %s */%s' % (', '.join('%d' % c for c in q), name, end))
+    print()
+    print('// 평균 필터 (계수 1/%d)' % args.taps)
+    print('#define LIGHT_FILTER_FIR_COEFF %d' % fir)
+    print()
+    print('#endif /* LIGHT_FILTER_COEFFS_H */')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+"""
+RGB LED 감마 보정 테이블 생성기 (src/gamma_table.h 생성)
+
+hal_entry.c 의 gamma_correct_duty_cycle() 이 pow() 대신 이 테이블을 읽는다.
+  table[d] = floor((d / period) ^ (1 / gamma) * period),  d = 0 ~ period
+
+사용 예)
+  python gamma_table.py > ../src/gamma_table.h
+  python gamma_table.py --gamma 2.8 --period 1000 > ../src/gamma_table.h
+"""
+import argparse
+
+
+def gamma_table(period, gamma):
+    return [int((d / period) ** (1 / gamma) * period) for d in range(period + 1)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='감마 보정 테이블 생성')
+    parser.add_argument('--period', type=int, default=1000, help='PWM 주기 (hal_entry.c RGB_PWM_PERIOD)')
+    parser.add_argument('--gamma', type=float, default=2.2)
+    args = parser.parse_args()
+
+    table = gamma_table(args.period, args.gamma)
+    print('/* tools/gamma_table.py 로 생성 (직접 수정하지 말 것) */')
+    print('#ifndef GAMMA_TABLE_H')
+    print('#define GAMMA_TABLE_H')
+    print()
+    print('#define GAMMA_TABLE_PERIOD %d' % args.period)
+    print('#define GAMMA_TABLE_GAMMA %s' % args.gamma)
+    print()
+    print('// table[d] = floor((d / %d) ^ (1 / %s) * %d), d = 0 ~ %d' % (args.period, args.gamma, args.period, args.period))
+    print('#define GAMMA_TABLE_VALUES \\')
+    rows = [table[i:i + 16] for i in range(0, len(table), 16)]
+    for i, row in enumerate(rows):
+        end = ', \\' if i < len(rows) - 1 else ''
+        print('    %s%s' % (', '.join('%4d' % v for v in row), end))
+    print()
+    print('#endif /* GAMMA_TABLE_H */')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""
+바이너리 프로토콜 PC 클라이언트 (src/bin_proto.h 의 바이너리 프로토콜용)
+
+요청: [0xA5][길이 N][seq][명령어 N바이트][CRC16 하위][CRC16 상위]
+응답: [0xA5][1][seq][상태][CRC16 하위][CRC16 상위]
+CRC16: CRC-16/CCITT-FALSE (다항식 0x1021, 초기값 0xFFFF), 길이 ~ 명령어 까지 계산
+
+응답을 기다리지 않고 요청을 여러 개 보낼 수 있다 (seq 로 응답 구분).
+응답이 아닌 바이트(카운트다운 같은 일반 텍스트 출력)는 건너뛴다.
+응답이 없는 요청(전송 중 바이트 손실)이 있으면 RX_TIMEOUT 이상 쉬고 다시 보낸다 (resync()):
+보드는 수신이 RX_TIMEOUT 동안 멈추면 받던 프레임을 버리고 처음 상태로 돌아간다.
+
+사용 예)
+  python uart_bin_client.py --port COM3 R50 G10 B40 "R0;G0;B100"
+
+  from uart_bin_client import BinClient
+  client = BinClient(serial.Serial('COM3', 115200, timeout=0.1))
+  seqs = [client.send(cmd) for cmd in ('R50', 'G10', 'B40')]   # 파이프라인 송신
+  print(client.wait_all(seqs))                                # {seq: 상태}
+"""
+import argparse
+import time
+
+SYNC = 0xA5
+PAYLOAD_MAX = 48    # bin_proto.h BIN_PAYLOAD_MAX
+RX_TIMEOUT = 0.05   # bin_proto.h BIN_RX_TIMEOUT_MS
+
+STATUS_OK = 0
+STATUS_CRC = 1
+STATUS_CMD = 2
+STATUS_LEN = 3
+STATUS_NAMES = {STATUS_OK: 'OK', STATUS_CRC: 'CRC 오류', STATUS_CMD: '명령어 오류', STATUS_LEN: '길이 오류'}
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE"""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def encode_frame(seq, payload):
+    """요청 프레임 만들기 (payload: bytes 또는 str)"""
+    if isinstance(payload, str):
+        payload = payload.encode('ascii')
+    if len(payload) > PAYLOAD_MAX:
+        raise ValueError('명령어가 너무 깁니다 (최대 %d 바이트)' % PAYLOAD_MAX)
+    body = bytes([len(payload), seq & 0xFF]) + payload
+    crc = crc16(body)
+    return bytes([SYNC]) + body + bytes([crc & 0xFF, crc >> 8])
+
+
+class FrameDecoder:
+    """수신 바이트에서 응답 프레임만 골라낸다. feed() 는 (seq, payload) 목록을 반환."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.crc_errors = 0
+
+    def feed(self, data):
+        self.buffer += data
+        frames = []
+        while True:
+            start = self.buffer.find(bytes([SYNC]))
+            if start < 0:
+                self.buffer.clear()
+                return frames
+            del self.buffer[:start]
+            if len(self.buffer) < 3:
+                return frames
+            length = self.buffer[1]
+            total = 1 + 2 + length + 2
+            if len(self.buffer) < total:
+                return frames
+            body = bytes(self.buffer[1:3 + length])
+            crc = self.buffer[3 + length] | (self.buffer[4 + length] << 8)
+            if crc16(body) == crc:
+                frames.append((body[1], body[2:]))
+                del self.buffer[:total]
+            else:
+                # 응답이 아닌 0xA5 이거나 깨진 프레임 > 1바이트 건너뛰고 다시 찾기
+                self.crc_errors += 1
+                del self.buffer[:1]
+
+
+class BinClient:
+    """port: read(n) / write(bytes) 가 있는 객체 (pyserial Serial 등)"""
+
+    def __init__(self, port):
+        self.port = port
+        self.decoder = FrameDecoder()
+        self.seq = 0
+        self.replies = {}   # seq > 상태
+
+    def send(self, command):
+        """요청 송신 (응답을 기다리지 않음), seq 반환"""
+        seq = self.seq
+        self.seq = (self.seq + 1) & 0xFF
+        self.replies.pop(seq, None)
+        self.port.write(encode_frame(seq, command))
+        return seq
+
+    def poll(self):
+        """도착한 응답 처리"""
+        data = self.port.read(256)
+        if data:
+            for seq, payload in self.decoder.feed(data):
+                self.replies[seq] = payload[0] if payload else None
+
+    def wait_all(self, seqs, timeout=2.0):
+        """seqs 의 응답을 모두 받을 때까지 대기, {seq: 상태} 반환 (시간 초과는 None)"""
+        deadline = time.monotonic() + timeout
+        while time.monotonic() < deadline and not all(s in self.replies for s in seqs):
+            self.poll()
+        return {s: self.replies.get(s) for s in seqs}
+
+    def execute(self, command, timeout=1.0):
+        """요청 하나 보내고 응답 대기"""
+        seq = self.send(command)
+        return self.wait_all([seq], timeout)[seq]
+
+    def resync(self):
+        """보드 수신 상태를 처음으로 (RX_TIMEOUT 보다 오래 송신을 쉼)"""
+        time.sleep(RX_TIMEOUT * 2)
+        self.poll()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='바이너리 프로토콜 클라이언트')
+    parser.add_argument('--port', required=True, help='시리얼 포트 (예: COM3, /dev/ttyACM0)')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('commands', nargs='+', help='명령어 (HDR/TAIL 제외, 예: R50 "R50;G10;B40")')
+    args = parser.parse_args()
+
+    import serial  # pyserial
+    with serial.Serial(args.port, args.baud, timeout=0.05) as ser:
+        client = BinClient(ser)
+        seqs = [client.send(cmd) for cmd in args.commands]  # 응답을 기다리지 않고 모두 송신
+        replies = client.wait_all(seqs)
+        for cmd, seq in zip(args.commands, seqs):
+            status = replies[seq]
+            print('%3d %-20s %s' % (seq, cmd, '응답 없음' if status is None else STATUS_NAMES.get(status, status)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""
+UART 토큰 로그 디코더 (hal_entry.c 의 UART_LOG_TOKENIZED 모드, uart_tx.c uart_tx_log 용)
+
+펌웨어는 uart_write(message, var) 대신 [0xFE][문자열 주소 3바이트][변수 2바이트] 를 보낸다.
+문자열 주소는 ELF 의 문자열 상수 주소이므로, 빌드된 ELF 가 그대로 문자열 테이블이 된다.
+0xFE 가 아닌 바이트(카운트다운 등 일반 텍스트 출력)는 그대로 출력한다.
+
+사용 예)
+  python uart_log_decode.py Debug/DHT11_Demo.elf capture.bin
+  python uart_log_decode.py Debug/DHT11_Demo.elf --port COM3 --baud 115200   (pyserial 필요)
+  python uart_log_decode.py Debug/DHT11_Demo.elf --dump 0x1234             (주소의 문자열 확인)
+"""
+import argparse
+import codecs
+import struct
+import sys
+
+TOKEN_SYNC = 0xFE
+TOKEN_LEN = 6       # sync 1 + 주소 3 + 변수 2
+NO_VAR = 0xFFFF     # uart_tx.h UART_TX_NO_VAR
+
+SHT_PROGBITS = 1
+SHF_ALLOC = 0x2
+
+
+class ElfStrings:
+    """ELF32 (little endian) 의 ALLOC+PROGBITS 섹션에서 주소로 문자열을 읽는다."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        if self.data[:4] != b'\x7fELF' or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError('ELF32 little endian 파일이 아닙니다: ' + path)
+
+        e_shoff, = struct.unpack_from('<I', self.data, 0x20)
+        e_shentsize, e_shnum = struct.unpack_from('<HH', self.data, 0x2E)
+        self.sections = []
+        for i in range(e_shnum):
+            (_, sh_type, sh_flags, sh_addr, sh_offset, sh_size) = \
+                struct.unpack_from('<IIIIII', self.data, e_shoff + i * e_shentsize)
+            if sh_type == SHT_PROGBITS and (sh_flags & SHF_ALLOC) and sh_size > 0:
+                self.sections.append((sh_addr, sh_offset, sh_size))
+        self.cache = {}
+
+    def string_at(self, address):
+        if address in self.cache:
+            return self.cache[address]
+        text = None
+        for sh_addr, sh_offset, sh_size in self.sections:
+            if sh_addr <= address < sh_addr + sh_size:
+                start = sh_offset + (address - sh_addr)
+                end = self.data.find(b'\0', start, sh_offset + sh_size)
+                if end >= 0:
+                    text = self.data[start:end].decode('utf-8', errors='replace')
+                break
+        self.cache[address] = text
+        return text
+
+
+def format_token(strings, address, var):
+    message = strings.string_at(address)
+    if message is None:
+        message = '<알 수 없는 토큰 0x%06X>' % address
+    if var == NO_VAR:
+        return '%s\r\n\033[0m' % message
+    return '%s: %u\r\n\033[0m' % (message, var)
+
+
+def decode_stream(strings, chunks, out):
+    """바이트 청크들을 받아서 토큰은 문자열로, 나머지는 그대로 out 에 쓴다."""
+    pending = b''
+    utf8 = codecs.getincrementaldecoder('utf-8')(errors='replace')  # 청크 경계에서 잘린 한글 처리
+    for chunk in chunks:
+        pending += chunk
+        text = bytearray()
+        i = 0
+        while i < len(pending):
+            if pending[i] != TOKEN_SYNC:
+                text.append(pending[i])
+                i += 1
+                continue
+            if len(pending) - i < TOKEN_LEN:
+                break  # 토큰이 다음 청크에 이어짐
+            address = pending[i + 1] | (pending[i + 2] << 8) | (pending[i + 3] << 16)
+            var = pending[i + 4] | (pending[i + 5] << 8)
+            text += format_token(strings, address, var).encode('utf-8')
+            i += TOKEN_LEN
+        pending = pending[i:]
+        out.write(utf8.decode(bytes(text)))
+        out.flush()
+
+
+def read_file(path):
+    with open(path, 'rb') as f:
+        while True:
+            chunk = f.read(4096)
+            if not chunk:
+                return
+            yield chunk
+
+
+def read_serial(port, baud):
+    import serial  # pyserial
+    with serial.Serial(port, baud, timeout=0.1) as ser:
+        while True:
+            chunk = ser.read(256)
+            if chunk:
+                yield chunk
+
+
+def main():
+    parser = argparse.ArgumentParser(description='UART 토큰 로그 디코더')
+    parser.add_argument('elf', help='펌웨어 ELF (예: Debug/DHT11_Demo.elf)')
+    parser.add_argument('capture', nargs='?', help='캡처한 UART 바이너리 파일 (생략 시 stdin)')
+    parser.add_argument('--port', help='시리얼 포트 (예: COM3, /dev/ttyACM0)')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--dump', metavar='ADDRESS', help='주소의 문자열 확인 (예: --dump 0x1234)')
+    args = parser.parse_args()
+
+    strings = ElfStrings(args.elf)
+    if args.dump:
+        print(strings.string_at(int(args.dump, 0)))
+        return
+
+    if args.port:
+        chunks = read_serial(args.port, args.baud)
+    elif args.capture:
+        chunks = read_file(args.capture)
+    else:
+        chunks = iter(lambda: sys.stdin.buffer.read(256), b'')
+    try:
+        decode_stream(strings, chunks, sys.stdout)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()